@@ -49,7 +49,7 @@ namespace Antares
 		pRoundingCountTotal(),
 		HOR(0.92),
 		pLimitMemory(200 * 1024 * 1024),
-		pCacheMemoryUsed(),
+		pThreadCount(1),
 		pAutoClean(false)
 	{
 	}
@@ -105,6 +105,7 @@ namespace Antares
 			logs.info() << "  lower bound  : (none)";
 
 		logs.info() << "  memory cache size : " << (pLimitMemory / 1024 / 1024) << "Mo";
+		logs.info() << "  threads : " << pThreadCount;
 		logs.info() << "  auto-clean : " << (pAutoClean ? "yes" : "no");
 
 		logs.info();
@@ -179,25 +180,4 @@ namespace Antares
 	}
 
 
-	bool ATSP::cachePreload(unsigned index, const AnyString& filename,
-		uint height, Matrix<>::BufferType& buffer)
-	{
-		enum
-		{
-			options = Matrix<>::optImmediate | Matrix<>::optFixedSize,
-		};
-		if (pCacheMatrix[index].loadFromCSVFile(filename, NBS, height, options, &buffer))
-		{
-			pCacheLastValidIndex = index + 1;
-			return true;
-		}
-		else
-			pCacheMatrix[index].clear();
-
-		return false;
-	}
-
-
-
-
 } // namespace Antares
@@ -168,14 +168,6 @@ namespace Antares
 
 		bool writeMoments() const;
 
-		void cacheCreate();
-		void cacheDestroy();
-		void cacheClear();
-		bool cacheFetch(uint index, Matrix<>& out) const;
-
-		bool cachePreload(uint index, const AnyString& filename,
-			uint height, Matrix<>::BufferType& buffer);
-
 
 	private:
 		AreaInfo::Vector pArea;
@@ -246,10 +238,10 @@ namespace Antares
 		static const uint posmois[12];
 		enum { durjour = 24 };
 
+		//! Memory limit for the time-series loaded at once (correlations)
 		yuint64 pLimitMemory;
-		yuint64 pCacheMemoryUsed;
-		uint pCacheLastValidIndex;
-		Matrix<>* pCacheMatrix;
+		//! The number of threads for computing the correlations
+		uint pThreadCount;
 
 		Yuni::String::Vector folderPerArea;
 		//! Temporary string mainly used for filename manipulation
@@ -265,6 +257,4 @@ namespace Antares
 
 } // namespace Antares
 
-# include "atsp.hxx"
-
 #endif // __PREPROCESSOR_ATSP_H__
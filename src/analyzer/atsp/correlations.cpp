@@ -27,7 +27,10 @@
 
 #include "atsp.h"
 #include <antares/date.h>
+#include <yuni/job/job.h>
+#include <yuni/job/queue/service.h>
 #include "../solver/misc/matrix-dp-make.h"
+#include <vector>
 
 
 using namespace Yuni;
@@ -39,14 +42,187 @@ using namespace Yuni;
 namespace Antares
 {
 
+	namespace // anonymous
+	{
+
+		/*!
+		** \brief Time-series of an area for a given month
+		**
+		** The expectation and the standard deviation of each time-series are
+		** computed once, when loading the data.
+		*/
+		class MonthlySeries final
+		{
+		public:
+			MonthlySeries() :
+				valid(false)
+			{}
+
+			bool load(const AnyString& filename, uint nbSeries, uint height)
+			{
+				Matrix<>::BufferType buffer;
+				valid = data.loadFromCSVFile(filename, nbSeries, height,
+					Matrix<>::optImmediate|Matrix<>::optFixedSize, &buffer);
+				if (not valid)
+				{
+					clear();
+					return false;
+				}
+
+				expectation.resize(nbSeries);
+				deviation.resize(nbSeries);
+				for (uint q = 0; q != nbSeries; ++q)
+				{
+					const Matrix<>::ColumnType& column = data.entry[q];
+					double sum = 0.;
+					double sumOfSquares = 0.;
+					for (uint i = 0; i != height; ++i)
+					{
+						sum += column[i];
+						sumOfSquares += column[i] * column[i];
+					}
+					expectation[q] = sum / height;
+
+					double x = sumOfSquares / height - expectation[q] * expectation[q];
+					deviation[q] = (x > 1e-9) ? sqrt(x) : 0.;
+				}
+				return true;
+			}
+
+			void clear()
+			{
+				valid = false;
+				data.clear();
+				expectation.clear();
+				deviation.clear();
+			}
+
+		public:
+			bool valid;
+			Matrix<> data;
+			std::vector<double> expectation;
+			std::vector<double> deviation;
+
+		}; // class MonthlySeries
+
+
+		/*!
+		** \brief Average of the correlations of the time-series of two areas
+		**
+		** The computations are the same as ATSP::Correlation() (code 0), with
+		** the moments computed beforehand.
+		*/
+		double AverageCorrelation(const MonthlySeries& a, const MonthlySeries& b, uint nbSeries, uint height)
+		{
+			double coeff = 0.;
+			for (uint q = 0; q != nbSeries; ++q)
+			{
+				const double sigmaA = a.deviation[q];
+				const double sigmaB = b.deviation[q];
+				double rho = 0.;
+
+				if (not (Math::Abs(sigmaA) < 1e-4 || Math::Abs(sigmaB) < 1e-4))
+				{
+					const Matrix<>::ColumnType& colA = a.data.entry[q];
+					const Matrix<>::ColumnType& colB = b.data.entry[q];
+					for (uint i = 0; i != height; ++i)
+						rho += colA[i] * colB[i];
+
+					rho /= height;
+					rho -= a.expectation[q] * b.expectation[q];
+					rho /= sigmaA;
+					rho /= sigmaB;
+
+					if (rho >  1)
+						rho = 1;
+					if (rho < -1)
+						rho = -1;
+				}
+				coeff += rho / nbSeries;
+			}
+			return coeff;
+		}
+
+
+		class LoadJob final : public Yuni::Job::IJob
+		{
+		public:
+			LoadJob(MonthlySeries& series, const AnyString& filename, uint nbSeries, uint height) :
+				pSeries(series),
+				pFilename(filename),
+				pNbSeries(nbSeries),
+				pHeight(height)
+			{}
+
+		private:
+			virtual void onExecute() override
+			{
+				if (not pSeries.load(pFilename, pNbSeries, pHeight))
+					logs.error() << "impossible to open " << pFilename;
+			}
+
+		private:
+			MonthlySeries& pSeries;
+			const String pFilename;
+			const uint pNbSeries;
+			const uint pHeight;
+		};
+
+
+		/*!
+		** \brief Correlations of an area with the areas [first, end[
+		*/
+		class CorrelationJob final : public Yuni::Job::IJob
+		{
+		public:
+			CorrelationJob(Matrix<>& out, const std::vector<MonthlySeries>& series, uint iZ,
+				uint first, uint end, uint nbSeries, uint height) :
+				pOut(out),
+				pSeries(series),
+				pIndex(iZ),
+				pFirst(first),
+				pEnd(end),
+				pNbSeries(nbSeries),
+				pHeight(height)
+			{}
+
+		private:
+			virtual void onExecute() override
+			{
+				const MonthlySeries& seriesI = pSeries[pIndex];
+				for (uint jZ = pFirst; jZ < pEnd; ++jZ)
+				{
+					const MonthlySeries& seriesJ = pSeries[jZ];
+					if (not seriesJ.valid)
+						continue;
+
+					// The rounding must be done later, otherwise CORR_YNP will
+					// be rounding as well
+					double coeff = AverageCorrelation(seriesI, seriesJ, pNbSeries, pHeight);
+					pOut.entry[pIndex][jZ] = coeff;
+					pOut.entry[jZ][pIndex] = coeff;
+				}
+			}
+
+		private:
+			Matrix<>& pOut;
+			const std::vector<MonthlySeries>& pSeries;
+			const uint pIndex;
+			const uint pFirst;
+			const uint pEnd;
+			const uint pNbSeries;
+			const uint pHeight;
+		};
+
+	} // anonymous namespace
+
+
+
 
 	bool ATSP::computeMonthlyCorrelations()
 	{
 		logs.checkpoint() << "Monthly correlation values";
 
-		// Prepare the cache
-		cacheCreate();
-
 		// pre-cleaning, just in case
 		SERIE_N.clear();
 		SERIE_P.clear();
@@ -89,97 +265,79 @@ namespace Antares
 			}
 		}
 
-		// Buffer for reading matrices
-		Matrix<>::BufferType buffer;
+		// The time-series of each area for the current month
+		// Only the areas of two chunks at most are in memory at once, according
+		// to the memory limit
+		std::vector<MonthlySeries> series(realAreaCount);
 
-		//
-		size_t sizePerMatrix = 744 * pTimeseriesCount * sizeof(double);
+		// The queue service for loading the data and computing the correlations
+		Job::QueueService qs;
+		qs.maximumThreadCount(pThreadCount);
+		qs.start();
 
 		for (uint m = 0; m < 12; ++m)
 		{
-			logs.info() << "Correlation: Precaching data for " << Antares::Date::MonthToString(m);
-			cacheClear();
+			const uint height = durmois[m];
 
+			// Loading the time-series of the areas [first, end[
+			auto loadChunk = [&] (uint first, uint end)
 			{
-				uint iZ = realAreaCount;
-				do
+				logs.info() << "Correlation: month: " << Antares::Date::MonthToString(m)
+					<< ", loading the areas " << (1 + first) << " to " << end << '/' << realAreaCount;
+				for (uint iZ = first; iZ != end; ++iZ)
 				{
-					if (pCacheMemoryUsed + sizePerMatrix > pLimitMemory)
-						break;
-					--iZ;
-					const uint i = mapping[iZ];
-					const String& folder = folderPerArea[i];
-					pStr.clear() << folder << SEP << "userfile-m";
+					pStr.clear() << folderPerArea[mapping[iZ]] << SEP << "userfile-m";
 					if (m < 10)
 						pStr << '0';
 					pStr << m << ".txt";
-
-					if (!cachePreload(i, pStr, durmois[m], buffer))
-						break;
+					qs.add(new LoadJob(series[iZ], pStr, NBS, height));
 				}
-				while (iZ);
-			}
-
-			for (uint iZ = 0; iZ < realAreaCount; ++iZ)
+				qs.wait(Yuni::qseIdle);
+			};
+			auto releaseChunk = [&] (uint first, uint end)
 			{
-				const uint i = mapping[iZ];
+				for (uint iZ = first; iZ != end; ++iZ)
+					series[iZ].clear();
+			};
 
-				// The folder for the area
-				const String& folder = folderPerArea[i];
+			// The number of areas in a chunk
+			const yuint64 sizePerMatrix = (yuint64) height * NBS * sizeof(double);
+			uint chunkSize = realAreaCount;
+			if (sizePerMatrix * realAreaCount > pLimitMemory)
+				chunkSize = Math::Max<uint>(1, (uint) (pLimitMemory / sizePerMatrix / 2));
 
+			for (uint i0 = 0; i0 < realAreaCount; i0 += chunkSize)
+			{
+				const uint i1 = Math::Min(i0 + chunkSize, realAreaCount);
+				loadChunk(i0, i1);
 
-				if (!cacheFetch(i, SERIE_N))
+				for (uint iZ = i0; iZ != i1; ++iZ)
 				{
-					pStr.clear() << folder << SEP << "userfile-m";
-					if (m < 10)
-						pStr << '0';
-					pStr << m << ".txt";
-					if (!SERIE_N.loadFromCSVFile(pStr, NBS, durmois[m], Matrix<>::optImmediate|Matrix<>::optFixedSize, &buffer))
-					{
-						logs.error() << "impossible to open " << pStr;
-						continue;
-					}
+					if (series[iZ].valid)
+						CORR_MNP.entry[iZ][iZ] = 1.;
 				}
 
-				CORR_MNP.entry[iZ][iZ] = 1.;
-				for (uint jZ = iZ + 1; jZ < realAreaCount; ++jZ)
+				for (uint j0 = i0; j0 < realAreaCount; j0 += chunkSize)
 				{
-					const uint j = mapping[jZ];
-					// The folder for the area
-					const String& folderJ = folderPerArea[j];
+					const uint j1 = Math::Min(j0 + chunkSize, realAreaCount);
+					if (j0 != i0)
+						loadChunk(j0, j1);
 
 					logs.info() << "Correlation: month: " << Antares::Date::MonthToString(m)
-						<< ", area " << (1+iZ) << '/' << realAreaCount << ": " << pArea[i]->name
-						<< " with area " << (1+jZ) << '/' << realAreaCount << ": " << pArea[j]->name;
+						<< ", areas " << (1 + i0) << " to " << i1 << " with areas "
+						<< (1 + j0) << " to " << j1 << '/' << realAreaCount;
 
-					if (!cacheFetch(j, SERIE_P))
+					for (uint iZ = i0; iZ != i1; ++iZ)
 					{
-						pStr.clear() << folderJ << SEP << "userfile-m";
-						if (m < 10)
-							pStr << '0';
-						pStr << m << ".txt";
-						if (!SERIE_P.loadFromCSVFile(pStr, NBS, durmois[m], Matrix<>::optImmediate|Matrix<>::optFixedSize, &buffer))
-							continue;
+						if (series[iZ].valid)
+							qs.add(new CorrelationJob(CORR_MNP, series, iZ, Math::Max(iZ + 1, j0), j1, NBS, height));
 					}
+					qs.wait(Yuni::qseIdle);
 
-
-					double coeff = 0.;
-					for (uint q = 0; q < NBS; ++q)
-					{
-						Extrait_col(buffer_n, SERIE_N, durmois[m], q);
-						Extrait_col(buffer_p, SERIE_P, durmois[m], q);
-						const double xx = Correlation(buffer_n, buffer_p, durmois[m],
-							moments_centr[i].data[m][0], moments_centr[j].data[m][0],
-							moments_centr[i].data[m][1], moments_centr[j].data[m][1], 0);
-
-						coeff += xx / NBS;
-					}
-
-					// The rounding must be done later, otherwise CORR_YNP will
-					// be rounding as well
-					CORR_MNP.entry[iZ][jZ] = coeff;
-					CORR_MNP.entry[jZ][iZ] = coeff;
+					if (j0 != i0)
+						releaseChunk(j0, j1);
 				}
+				releaseChunk(i0, i1);
 			}
 
 			for (uint i = 0; i < realAreaCount; ++i)
@@ -253,14 +411,15 @@ namespace Antares
 			resultNDP.saveToCSVFile(pStr);
 		}
 
+		qs.stop();
+
 		// Memory cleaning
-		buffer.clear().shrink();
+		series.clear();
 		SERIE_N.clear();
 		SERIE_P.clear();
 		SERIE_Q.clear();
 		CORR_MNP.clear();
 		moments_centr.clear();
-		cacheDestroy();
 
 
 		// Rounding annual correlation coefficients
@@ -26,6 +26,7 @@
 */
 #include "atsp.h"
 #include <antares/inifile.h>
+#include <yuni/core/system/cpu.h>
 #include "../../config.h"
 #include "../../internet/limits.h"
 
@@ -53,6 +54,7 @@ namespace Antares
 		pLowerBound = 0.;
 		pUpperBound80percent = 0.;
 		pLimitMemory = 200 * 1024 * 1024;
+		pThreadCount = System::CPU::Count();
 		pAutoClean = false;
 
 		IniFile ini;
@@ -160,6 +162,13 @@ namespace Antares
 								pLimitMemory *= 1024u * 1024u;
 							continue;
 						}
+						if (key == "threads")
+						{
+							pThreadCount = value.to<uint>();
+							if (pThreadCount == 0)
+								pThreadCount = System::CPU::Count();
+							continue;
+						}
 						if (key == "clean")
 						{
 							pAutoClean = value.to<bool>();
@@ -76,17 +76,44 @@ long NombreDeSuperTableauxStandards;
 long TailleStandardDeDepart;
 long TailleStandard;
 
+/* Mode arene (voir mem_arene.c) */
+char   ModeArene;
+char * AreneEnCours;
+long   PositionDansLArene;
+long   TailleDeLArene;
+
+/* Statistiques */
+long NombreDAllocations;
+long NombreDOctetsAlloues;
+
 } MEMOIRE_THREAD;
 
+/* Entete de chaque zone d'une arene: les zones sont chainees pour etre liberees en une seule fois */
+typedef struct {
+char * ArenePrecedente;
+long   Taille;
+} ENTETE_ARENE;
+
 # define CYCLE_SHIFT       5
 # define TAILLE_STANDARD  (1024*1024*2) 
 # define TAILLE_MIN_USER  (1024) /* Ce qu'il doit rester au minimum pour creer un bloc */
 # define TAILLE_MIN_BLOC  ( sizeof( ENTETE ) + TAILLE_MIN_USER )
+# define TAILLE_MIN_ARENE (1024*256) /* Taille minimale du premier tableau d'une arene */
+
+# if defined(_MSC_VER)
+  # define MEM_THREAD_LOCAL __declspec(thread)
+# else
+  # define MEM_THREAD_LOCAL __thread
+# endif
 
-long MEM_ClassementTriRapide( char ** , long * , long , long );
-void MEM_Classement( char ** , long * , long , long );
-void MEM_DefragmenterLEspaceLibre( BLOCS_LIBRES * );
-char MEM_AllocSuperTableau( void * , long ); 
+long   MEM_QuantiteLibre( BLOCS_LIBRES * );
+long   MEM_ClassementTriRapide( char ** , long * , long , long );
+void   MEM_Classement( char ** , long * , long , long );
+void   MEM_DefragmenterLEspaceLibre( BLOCS_LIBRES * );
+char   MEM_AllocSuperTableau( void * , long ); 
+char * MEM_MallocArene( MEMOIRE_THREAD * , size_t );
+char * MEM_ReallocArene( MEMOIRE_THREAD * , void * , size_t );
+void   MEM_QuitArene( MEMOIRE_THREAD * );
 
 /*****************************************************************/	
 # define DONNEES_INTERNES_MEMOIRE_DEJA_DEFINIES
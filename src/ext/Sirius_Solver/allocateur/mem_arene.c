@@ -0,0 +1,182 @@
+/*
+** Copyright 2007-2018 RTE
+** Author: Robert Gonzalez
+**
+** This file is part of Sirius_Solver.
+** This program and the accompanying materials are made available under the
+** terms of the Eclipse Public License 2.0 which is available at
+** http://www.eclipse.org/legal/epl-2.0.
+**
+** This Source Code may also be made available under the following Secondary
+** Licenses when the conditions for such availability set forth in the Eclipse
+** Public License, v. 2.0 are satisfied: GNU General Public License, version 3
+** or later, which is available at <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: EPL-2.0 OR GPL-3.0
+*/
+/***********************************************************************
+
+FONCTION: Allocateur en mode arene.
+          Les zones sont prises les unes a la suite des autres dans de
+          grands tableaux et ne sont jamais liberees individuellement:
+          pas de recherche de bloc libre ni de defragmentation. Tout est
+          libere en une seule fois par MEM_Quit.
+          La taille du premier tableau est la quantite consommee par la
+          derniere arene liberee dans le thread, de sorte qu'un meme
+          calcul repete (une factorisation par exemple) ne fasse en
+          general qu'un seul malloc.
+
+************************************************************************/
+
+# include "mem_allocateur.h"
+
+/* Quantite consommee par la derniere arene liberee dans le thread */
+static MEM_THREAD_LOCAL long MEM_ConsommationDeLaDerniereArene = 0;
+
+/**************************************************************************/
+
+static char MEM_AllouerUnTableauDArene( MEMOIRE_THREAD * Mem, long Taille )
+{
+char * Tableau;
+
+Tableau = (char *) malloc( (size_t) Taille );
+if ( Tableau == NULL ) return( 0 );
+
+((ENTETE_ARENE *) Tableau)->ArenePrecedente = Mem->AreneEnCours;
+((ENTETE_ARENE *) Tableau)->Taille          = Taille;
+
+Mem->AreneEnCours       = Tableau;
+Mem->TailleDeLArene     = Taille;
+Mem->PositionDansLArene = (long) sizeof( ENTETE_ARENE );
+
+return( 1 );
+}
+
+/**************************************************************************/
+
+void * MEM_InitArene()
+{
+MEMOIRE_THREAD * h; long Taille;
+
+h = (MEMOIRE_THREAD *) malloc( sizeof( MEMOIRE_THREAD ) );
+if ( h == NULL ) return( NULL );
+
+h->NombreDeSuperTableaux          = 0;
+h->PageAllocEnCours               = 0;
+h->NombreDeSuperTableauxStandards = 0;
+h->TailleStandard                 = (long) TAILLE_STANDARD;
+h->TailleStandardDeDepart         = (long) TAILLE_STANDARD;
+h->ModeArene                      = 1;
+h->AreneEnCours                   = NULL;
+h->PositionDansLArene             = 0;
+h->TailleDeLArene                 = 0;
+h->NombreDAllocations             = 0;
+h->NombreDOctetsAlloues           = 0;
+
+Taille = MEM_ConsommationDeLaDerniereArene + (long) sizeof( ENTETE_ARENE );
+if ( Taille < (long) TAILLE_MIN_ARENE ) Taille = (long) TAILLE_MIN_ARENE;
+
+if ( MEM_AllouerUnTableauDArene( h, Taille ) == 0 ) {
+  free( h );
+  return( NULL );
+}
+
+return( (void *) h );
+}
+
+/**************************************************************************/
+
+char * MEM_MallocArene( MEMOIRE_THREAD * Mem, size_t NombreDOctets ) 
+{
+long NbOctetsAReserver; long Taille; ENTETE * Entete;
+
+NbOctetsAReserver = (long) NombreDOctets + (long) sizeof( ENTETE );
+ALIGN( NbOctetsAReserver );
+
+if ( Mem->PositionDansLArene + NbOctetsAReserver > Mem->TailleDeLArene ) {
+  /* Le nouveau tableau est au moins 2 fois plus grand que le precedent */
+  Taille = Mem->TailleDeLArene << 1;
+  if ( Taille < NbOctetsAReserver + (long) sizeof( ENTETE_ARENE ) ) {
+	  Taille = NbOctetsAReserver + (long) sizeof( ENTETE_ARENE );
+	}
+  # ifdef TRACES_ALLOC_SUPERTABLEAU
+	  printf("Arene: allocation d'un nouveau tableau de taille %ld\n",Taille);
+	# endif
+  if ( MEM_AllouerUnTableauDArene( Mem, Taille ) == 0 ) return( NULL );
+}
+
+Entete = (ENTETE *) (Mem->AreneEnCours + Mem->PositionDansLArene);
+Entete->Taille             = NbOctetsAReserver;
+Entete->AdresseBlocsLibres = NULL;
+Entete->NombreDAllocs      = 0;
+
+Mem->PositionDansLArene+= NbOctetsAReserver;
+Mem->NombreDAllocations++;
+Mem->NombreDOctetsAlloues+= (long) NombreDOctets;
+
+return( (char *) Entete + sizeof( ENTETE ) );
+}
+
+/**************************************************************************/
+
+char * MEM_ReallocArene( MEMOIRE_THREAD * Mem, void * Pt, size_t NombreDOctets )
+{
+long Taille; long TailleDispo; long Nboct; ENTETE * Entete; char * NouvelleAdresse;
+
+if ( Pt == NULL ) return( MEM_MallocArene( Mem, NombreDOctets ) );
+
+Entete      = (ENTETE *) ((char *) Pt - sizeof( ENTETE ));
+Taille      = Entete->Taille;
+TailleDispo = Taille - (long) sizeof( ENTETE );
+
+/* S'il y a la place necessaire, on ne fait rien */
+if ( TailleDispo >= (long) NombreDOctets ) return( (char *) Pt );
+
+Nboct = (long) NombreDOctets + (long) sizeof( ENTETE );
+ALIGN( Nboct );
+
+/* Si la zone est la derniere de l'arene et qu'il reste de la place derriere, on l'agrandit sur place */
+if ( (char *) Entete + Taille == Mem->AreneEnCours + Mem->PositionDansLArene ) {
+  if ( Mem->PositionDansLArene + Nboct - Taille <= Mem->TailleDeLArene ) {
+	  Entete->Taille = Nboct;
+    Mem->PositionDansLArene+= Nboct - Taille;
+    Mem->NombreDOctetsAlloues+= (long) NombreDOctets - TailleDispo;
+	  return( (char *) Pt );
+	}
+}
+
+/* Sinon on prend une nouvelle zone, l'ancienne sera liberee avec l'arene */
+NouvelleAdresse = MEM_MallocArene( Mem, NombreDOctets );
+if ( NouvelleAdresse == NULL ) return( NULL );
+
+memcpy( NouvelleAdresse, (char *) Pt, (size_t) TailleDispo * sizeof( char ) );
+
+return( NouvelleAdresse );
+}
+
+/**************************************************************************/
+
+void MEM_QuitArene( MEMOIRE_THREAD * Mem ) 
+{
+char * Tableau; char * ArenePrecedente; long Consommation;
+
+# ifdef TRACES_QUIT
+  printf("Arene: nombre d'allocations %ld  octets alloues %ld\n",Mem->NombreDAllocations,Mem->NombreDOctetsAlloues);
+# endif
+
+Consommation = 0;
+Tableau = Mem->AreneEnCours;
+while ( Tableau != NULL ) {
+  ArenePrecedente = ((ENTETE_ARENE *) Tableau)->ArenePrecedente;
+	if ( Tableau == Mem->AreneEnCours ) Consommation+= Mem->PositionDansLArene;
+	else Consommation+= ((ENTETE_ARENE *) Tableau)->Taille;
+  free( Tableau );
+	Tableau = ArenePrecedente;
+}
+
+MEM_ConsommationDeLaDerniereArene = Consommation;
+
+free( Mem );
+
+return;
+}
@@ -22,11 +22,12 @@
 /*****************************************************************/
 
 void * MEM_Init( void );
+void * MEM_InitArene( void );
 void   MEM_Quit( void * );
 char * MEM_Malloc( void * , size_t );
 void   MEM_Free( void * ); 
 char * MEM_Realloc( void * , void * , size_t );
-long   MEM_QuantiteLibre( BLOCS_LIBRES * );
+void   MEM_Statistiques( void * , long * , long * );
 
 /*****************************************************************/
 # define FONCTION_EXTERNES_MEMOIRE_DEJA_DEFINIES
@@ -40,6 +40,9 @@ Taille = ((ENTETE *) AdresseALibere)->Taille;
 
 BlocsLibres = (BLOCS_LIBRES *) ((ENTETE *) AdresseALibere)->AdresseBlocsLibres;
 
+/* Zone d'une arene: elle n'est liberee qu'avec l'arene (MEM_Quit) */
+if ( BlocsLibres == NULL ) return;
+
 NombreDeBlocsLibres = BlocsLibres->NombreDeBlocsLibres;
 AdresseDuBlocLibre  = BlocsLibres->AdresseDuBlocLibre;
 TailleDuBlocLibre   = BlocsLibres->TailleDuBlocLibre;
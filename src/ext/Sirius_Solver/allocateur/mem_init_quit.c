@@ -37,6 +37,12 @@ if ( h != NULL ) {
 	h->NombreDeSuperTableauxStandards = 0;
   h->TailleStandard                 = (long) TAILLE_STANDARD;
   h->TailleStandardDeDepart         = (long) TAILLE_STANDARD;
+  h->ModeArene                      = 0;
+  h->AreneEnCours                   = NULL;
+  h->PositionDansLArene             = 0;
+  h->TailleDeLArene                 = 0;
+  h->NombreDAllocations             = 0;
+  h->NombreDOctetsAlloues           = 0;
 }
 
 /* Allocation d'un super petit tableau */
@@ -57,6 +63,11 @@ long i; MEMOIRE_THREAD * Mem; BLOCS_LIBRES * BlocsLibres;
 if ( h == NULL ) return;
 Mem = (MEMOIRE_THREAD *) h;
 
+if ( Mem->ModeArene == 1 ) {
+  MEM_QuitArene( Mem );
+  return;
+}
+
 # ifdef TRACES_QUIT
   printf("Nombre de super tableaux alloues %ld\n",Mem->NombreDeSuperTableaux);
 # endif
@@ -80,6 +91,22 @@ return;
 
 /**************************************************************************/
 
+void MEM_Statistiques( void * h, long * NombreDAllocations, long * NombreDOctetsAlloues )
+{
+MEMOIRE_THREAD * Mem;
+
+*NombreDAllocations   = 0;
+*NombreDOctetsAlloues = 0;
+if ( h == NULL ) return;
+Mem = (MEMOIRE_THREAD *) h;
+
+*NombreDAllocations   = Mem->NombreDAllocations;
+*NombreDOctetsAlloues = Mem->NombreDOctetsAlloues;
+return;
+}
+
+/**************************************************************************/
+
 long MEM_QuantiteLibre( BLOCS_LIBRES * BlocsLibres )
 { long k; long T; long * TailleDuBlocLibre; 
   T = 0;
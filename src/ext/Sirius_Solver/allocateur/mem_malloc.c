@@ -42,6 +42,11 @@ if ( h == NULL ) return( AdresseAllouee );
 
 Mem = (MEMOIRE_THREAD *) h;
 
+if ( Mem->ModeArene == 1 ) return( MEM_MallocArene( Mem, NombreDOctets ) );
+
+Mem->NombreDAllocations++;
+Mem->NombreDOctetsAlloues+= (long) NombreDOctets;
+
 NbOctetsAReserver = (long ) NombreDOctets + sizeof( ENTETE );
 
 ALIGN( NbOctetsAReserver );
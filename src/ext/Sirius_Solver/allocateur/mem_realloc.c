@@ -42,6 +42,8 @@ if ( h == NULL ) return( NouvelleAdresse );
  
 Mem = (MEMOIRE_THREAD *) h;
 
+if ( Mem->ModeArene == 1 ) return( MEM_ReallocArene( Mem, Pt, NombreDOctets ) );
+
 /* Si la taille demandee est plus petite on ne fait rien */
 Entete = (ENTETE *) ((char *) Pt - sizeof( ENTETE ));
 Taille      = Entete->Taille;
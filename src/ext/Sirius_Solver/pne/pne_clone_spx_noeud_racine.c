@@ -247,6 +247,7 @@ Probleme.LibererMemoireALaFin  = NON_SPX;
 
 Probleme.CoutMax         = LINFINI_PNE;
 Probleme.UtiliserCoutMax = NON_SPX;
+Probleme.NombreDeThreadsDePricing = 1;
 
 Probleme.NombreDeContraintesCoupes        = 0; /* Car integrees dans les contraintes */
 Probleme.BCoupes                          = NULL;
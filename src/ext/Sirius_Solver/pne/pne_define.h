@@ -290,6 +290,7 @@ int NombreDeReactivationsSansSuccesHeuristiqueFractionalDive;
 
 /*                                       */
 char   FaireDuPresolve;
+void * SequenceDePresolve; /* SEQUENCE_DE_PRESOLVE de l'appelant, NULL si on fait un presolve complet */
 int    TempsDExecutionMaximum; /* En secondes */
 char   AffichageDesTraces;
 int    NombreMaxDeSolutionsEntieres;
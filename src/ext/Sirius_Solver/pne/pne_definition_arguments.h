@@ -44,6 +44,29 @@
     
 */
 
+/* 
+   Memorisation de la sequence de reductions du presolve (facultatif).
+   Lorsqu'un probleme de meme structure est resolu de nombreuses fois (seuls les bornes, les
+   seconds membres et les couts changent), le presolve complet enregistre, pour chaque cycle,
+   les reductions qui ont effectivement modifie le probleme. Aux appels suivants on ne rejoue
+   que ces reductions. Chacune d'elles refait ses propres controles sur les donnees courantes:
+   une reduction qui ne s'applique plus ne fait rien et le probleme est simplement moins reduit.
+   La sequence n'est rejouee que si les dimensions du probleme sont celles de l'enregistrement,
+   sinon on refait un presolve complet qui enregistre une nouvelle sequence.
+   Pour forcer un presolve complet, mettre Enregistree a NON_PNE.
+   L'appelant alloue la structure et met Enregistree a NON_PNE avant le premier appel.
+*/
+# define NOMBRE_MAX_DE_CYCLES_DE_PRESOLVE  5
+
+typedef struct {
+  char  Enregistree;          /* OUI_PNE si une sequence a ete enregistree par un presolve complet */
+  char  Rejouee;              /* En sortie: OUI_PNE si le dernier presolve a rejoue la sequence */
+  int   NombreDeVariables;    /* Dimensions du probleme (apres mise en forme) lors de l'enregistrement */
+  int   NombreDeContraintes;
+  int   NombreDeCycles;       /* Nombre de cycles de presolve a rejouer */
+  int   ReductionsDuCycle[NOMBRE_MAX_DE_CYCLES_DE_PRESOLVE]; /* Pour chaque cycle, reductions a rejouer */
+} SEQUENCE_DE_PRESOLVE;
+
 typedef struct {
 
   int     NombreDeVariables;   /* Nombre de variables */
@@ -129,6 +152,10 @@ La matrice des contrainte est decrite par les 4 vecteurs qui suivent. Elle doit
 				                                 couteux.
 				                               - Mettre OUI_PNE si le probleme est difficile a resoudre.
 				                           */																	 
+  SEQUENCE_DE_PRESOLVE * SequenceDePresolve; /* Mettre NULL pour faire un presolve complet a chaque appel.
+                                                Sinon, sequence de presolve memorisee d'un appel a l'autre
+                                                (voir SEQUENCE_DE_PRESOLVE). Sans effet si FaireDuPresolve
+                                                vaut NON_PNE */
 } PROBLEME_A_RESOUDRE;
 
 
@@ -101,6 +101,7 @@ Probleme.LibererMemoireALaFin  = NON_SPX;
 
 Probleme.CoutMax         = CoutMax;
 Probleme.UtiliserCoutMax = UtiliserCoutMax; 
+Probleme.NombreDeThreadsDePricing = 1;
 
 Probleme.NombreDeContraintesCoupes        = Pne->Coupes.NombreDeContraintes;
 Probleme.BCoupes                          = Pne->Coupes.B;
@@ -137,6 +137,7 @@ Probleme.CoupesLiftAndProject       = NON_PNE;
 Probleme.AffichageDesTraces = OUI_PNE;
 
 Probleme.FaireDuPresolve = NON_PNE /* OUI_PNE */;        
+Probleme.SequenceDePresolve = NULL;
 
 Probleme.TempsDExecutionMaximum = 10;  
 
@@ -215,6 +215,7 @@ Probleme.LibererMemoireALaFin = NON_SPX;
 
 Probleme.CoutMax         = LINFINI_PNE;
 Probleme.UtiliserCoutMax = NON_SPX;
+Probleme.NombreDeThreadsDePricing = 1;
 
 printf("Relance du SIMPLEXE au noeud racine Nomnre De Coupes = %d\n",Coupes->NombreDeCoupes);
 
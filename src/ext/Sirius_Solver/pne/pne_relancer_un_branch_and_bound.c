@@ -275,6 +275,7 @@ Probleme.CoupesLiftAndProject       = NON_PNE;
 Probleme.AffichageDesTraces = OUI_PNE;
 
 Probleme.FaireDuPresolve = OUI_PNE;          
+Probleme.SequenceDePresolve = NULL;
 
 Probleme.TempsDExecutionMaximum = 0;  
 
@@ -158,6 +158,7 @@ Probleme.LibererMemoireALaFin  = LibererMemoireALaFin;
 
 Probleme.CoutMax = CoutMax;
 Probleme.UtiliserCoutMax = UtiliserCoutMax;
+Probleme.NombreDeThreadsDePricing = 1;
 
 Probleme.NombreDeContraintesCoupes        = Pne->Coupes.NombreDeContraintes;
 Probleme.BCoupes                          = Pne->Coupes.B;
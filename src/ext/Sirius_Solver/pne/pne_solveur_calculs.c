@@ -86,6 +86,7 @@ if ( Pne->AffichageDesTraces == OUI_PNE && Pne->Controls == NULL ) {
   printf("\n");
 }
 Pne->FaireDuPresolve              = Probleme->FaireDuPresolve;
+Pne->SequenceDePresolve           = (void *) Probleme->SequenceDePresolve;
 Pne->TempsDExecutionMaximum       = Probleme->TempsDExecutionMaximum;
 Pne->NombreMaxDeSolutionsEntieres = Probleme->NombreMaxDeSolutionsEntieres;
 Pne->ToleranceDOptimalite         = Probleme->ToleranceDOptimalite;
@@ -83,6 +83,7 @@ void * StandAloneLancerUnThread( void * Arg )
   Probleme.CoupesLiftAndProject       = NON_PNE;
   Probleme.AffichageDesTraces         = OUI_PNE; 
   Probleme.FaireDuPresolve            = OUI_PNE;     
+  Probleme.SequenceDePresolve         = NULL;
   if ( Probleme.FaireDuPresolve == NON_PNE ) printf("Attention pas de presolve\n");
   Probleme.TempsDExecutionMaximum       = 3600 * 0 /*3600 * 0*/;
   Probleme.NombreMaxDeSolutionsEntieres = -1;
@@ -278,6 +279,7 @@ for ( j = 0 ; j < 1 ; j++ ) { /* Pour tester les fuites memoire on enchaine les
   Probleme.CoupesLiftAndProject       = NON_PNE; 
   Probleme.AffichageDesTraces         = NON_PNE; 
   Probleme.FaireDuPresolve            = OUI_PNE /* OUI_PNE */;               
+  Probleme.SequenceDePresolve         = NULL;
   if ( Probleme.FaireDuPresolve == NON_PNE ) printf("!!!!!!!!!!!!!!  Attention pas de presolve   !!!!!!!!!\n");
 
   Probleme.TempsDExecutionMaximum       = 0;  
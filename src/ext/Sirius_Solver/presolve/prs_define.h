@@ -68,6 +68,19 @@
 # define SUPPRESSION_CONTRAINTE_COLINEAIRE 6  /* Pour trouver la variable duale de la contrainte */
 
 # define VARIABLE_FIXEE                    7  /* Inutilise pour l'instant */
+
+/* Les reductions d'un cycle de presolve (pour l'enregistrement et le rejeu de la sequence de presolve) */
+# define PRS_REDUCTION_SINGLETONS_SUR_LIGNES        0x0001
+# define PRS_REDUCTION_SINGLETONS_SUR_COLONNES      0x0002
+# define PRS_REDUCTION_VARIABLES_NON_BORNEES        0x0004
+# define PRS_REDUCTION_BORNES_DES_CONTRAINTES       0x0008 /* Bornes des contraintes, contraintes inactives et amelioration des bornes */
+# define PRS_REDUCTION_VARIABLES_DUALES             0x0010 /* Bornes des variables duales et des couts reduits */
+# define PRS_REDUCTION_FIXATION_SUR_CRITERE         0x0020
+# define PRS_REDUCTION_VARIABLES_HORS_CONTRAINTES   0x0040
+# define PRS_REDUCTION_SUBSTITUTION_DE_VARIABLES    0x0080
+# define PRS_REDUCTION_CONTRAINTES_COLINEAIRES      0x0100
+# define PRS_REDUCTION_COLONNES_COLINEAIRES         0x0200
+# define PRS_TOUTES_LES_REDUCTIONS                  0x03FF
 	
 /*******************************************************************************************************/
 
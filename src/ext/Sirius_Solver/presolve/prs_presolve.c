@@ -60,6 +60,8 @@ double * ValeurDeXPourPresolve; double * BorneInfPourPresolve; double * BorneSup
 char * ConserverLaBorneSupDuPresolve; char * ConserverLaBorneInfDuPresolve;  int NbVarNb;
 char BorneInfPresolveDisponible; char BorneSupPresolveDisponible; char TypeBrn;
 double Marge; PRESOLVE * Presolve; PROBLEME_PNE * Pne;
+SEQUENCE_DE_PRESOLVE * Sequence; char Rejeu; int ReductionsAFaire; int ReductionsEffectives;
+int NombreDeVariablesInitial; int NombreDeContraintesInitial;
 
 Pne = (PROBLEME_PNE *) PneE;
 
@@ -139,11 +141,27 @@ if ( Pne->FaireDuPresolve == NON_PNE ) goto FinDuPresolve;
   PNE_AmeliorerLesCoefficientsDesVariablesBinaires( Pne, (void *) Presolve, MODE_PRESOLVE );	
 # endif
 
+/* Sequence de presolve memorisee par l'appelant: on la rejoue si elle a ete enregistree sur un
+   probleme de memes dimensions, sinon on fait un presolve complet qui l'enregistre */
+Sequence = (SEQUENCE_DE_PRESOLVE *) Pne->SequenceDePresolve;
+NombreDeVariablesInitial = Pne->NombreDeVariablesTrav;
+NombreDeContraintesInitial = Pne->NombreDeContraintesTrav;
+Rejeu = NON_PNE;
+if ( Sequence != NULL ) {
+  if ( Sequence->Enregistree == OUI_PNE && Sequence->NombreDeVariables == NombreDeVariablesInitial &&
+       Sequence->NombreDeContraintes == NombreDeContraintesInitial ) Rejeu = OUI_PNE;
+  else Sequence->Enregistree = NON_PNE;
+  Sequence->Rejouee = Rejeu;
+}
+
 DebutDesCycles:
 NbCycles = 0;
 NbMetaCycles++;
 Relancer = OUI_PNE;   /* C'est juste pour passer dans le while */
-while ( Relancer == OUI_PNE && NbCycles < 5 /*5*/ && Pne->YaUneSolution != PROBLEME_INFAISABLE ) {
+while ( Relancer == OUI_PNE && NbCycles < NOMBRE_MAX_DE_CYCLES_DE_PRESOLVE /*5*/ && Pne->YaUneSolution != PROBLEME_INFAISABLE ) {
+
+  /* En rejeu, on s'arrete apres le dernier cycle enregistre */
+  if ( Rejeu == OUI_PNE && NbCycles >= Sequence->NombreDeCycles ) break;
 
   NbCycles++;
 	
@@ -151,132 +169,174 @@ while ( Relancer == OUI_PNE && NbCycles < 5 /*5*/ && Pne->YaUneSolution != PROBL
     printf("Cycle de presolve numero %d \n",NbCycles);
   #endif
   Relancer = NON_PNE;
+	
+  ReductionsEffectives = 0;
+  ReductionsAFaire = PRS_TOUTES_LES_REDUCTIONS;
+  if ( Rejeu == OUI_PNE ) ReductionsAFaire = Sequence->ReductionsDuCycle[NbCycles - 1];
 		
 	/* Singleton sur ligne */	
-	NbModifications = 1;	
-	while( NbModifications > 0 ) {  
-	  NbModifications = 0;
-	  PRS_SingletonsSurLignes( Presolve, &NbModifications );
-		# if TRACES == 1
-	    if ( Pne->YaUneSolution != OUI_PNE ) printf("Probleme infaisable apres PRS_SingletonsSurLignes\n");
-		# endif
-	  if ( Pne->YaUneSolution != OUI_PNE ) break;
-    if ( NbModifications != 0 ) Relancer = OUI_PNE;		
-  }	
+  if ( ReductionsAFaire & PRS_REDUCTION_SINGLETONS_SUR_LIGNES ) {
+  	NbModifications = 1;	
+  	while( NbModifications > 0 ) {  
+  	  NbModifications = 0;
+  	  PRS_SingletonsSurLignes( Presolve, &NbModifications );
+  		# if TRACES == 1
+  	    if ( Pne->YaUneSolution != OUI_PNE ) printf("Probleme infaisable apres PRS_SingletonsSurLignes\n");
+  		# endif
+  	  if ( Pne->YaUneSolution != OUI_PNE ) break;
+      if ( NbModifications != 0 ) { Relancer = OUI_PNE; ReductionsEffectives |= PRS_REDUCTION_SINGLETONS_SUR_LIGNES; }		
+    }	
+  }
 			
 	/* Singleton sur colonne */	
-  NbModifications = 1;
-  while( NbModifications > 0 ) {
-	  NbModifications = 0;
-	  PRS_SingletonsSurColonnes( Presolve, &NbModifications );
-		# if TRACES == 1
-	    if ( Pne->YaUneSolution != OUI_PNE ) printf("Probleme infaisable apres PRS_SingletonsSurColonnes\n");
-		# endif		
-	  if ( Pne->YaUneSolution != OUI_PNE ) break;
-	  if ( NbModifications != 0 ) Relancer = OUI_PNE;
-	}	
+  if ( ReductionsAFaire & PRS_REDUCTION_SINGLETONS_SUR_COLONNES ) {
+    NbModifications = 1;
+    while( NbModifications > 0 ) {
+  	  NbModifications = 0;
+  	  PRS_SingletonsSurColonnes( Presolve, &NbModifications );
+  		# if TRACES == 1
+  	    if ( Pne->YaUneSolution != OUI_PNE ) printf("Probleme infaisable apres PRS_SingletonsSurColonnes\n");
+  		# endif		
+  	  if ( Pne->YaUneSolution != OUI_PNE ) break;
+  	  if ( NbModifications != 0 ) { Relancer = OUI_PNE; ReductionsEffectives |= PRS_REDUCTION_SINGLETONS_SUR_COLONNES; }
+  	}	
+  }
 	
 	/* On cherche a borner les limites infinies a l'aide contraintes dont il manque
 	   des bornes a une seule variable */
   
-	PRS_BornerLesVariablesNonBornees( Presolve, &NbModifications );
-	# if TRACES == 1
-	  if ( Pne->YaUneSolution != OUI_PNE ) printf("Probleme infaisable apres PRS_BornerLesVariablesNonBornees\n");
-	# endif			
-  if ( Pne->YaUneSolution != OUI_PNE ) break;
-  if ( NbModifications != 0 ) Relancer = OUI_PNE;
+  if ( ReductionsAFaire & PRS_REDUCTION_VARIABLES_NON_BORNEES ) {
+  	PRS_BornerLesVariablesNonBornees( Presolve, &NbModifications );
+  	# if TRACES == 1
+  	  if ( Pne->YaUneSolution != OUI_PNE ) printf("Probleme infaisable apres PRS_BornerLesVariablesNonBornees\n");
+  	# endif			
+    if ( Pne->YaUneSolution != OUI_PNE ) break;
+    if ( NbModifications != 0 ) { Relancer = OUI_PNE; ReductionsEffectives |= PRS_REDUCTION_VARIABLES_NON_BORNEES; }
+  }
 		
   /* On cherche a ameliorer les bornes */		
-  PRS_CalculerLesBornesDeToutesLesContraintes( Presolve, &NbModifications );
-	# if TRACES == 1
-	  if ( Pne->YaUneSolution != OUI_PNE ) printf("Probleme infaisable apres PRS_CalculerLesBornesDeToutesLesContraintes\n");
-	# endif			
-	if ( Pne->YaUneSolution != OUI_PNE ) break;
-  if ( NbModifications != 0 ) Relancer = OUI_PNE;	    	
+  if ( ReductionsAFaire & PRS_REDUCTION_BORNES_DES_CONTRAINTES ) {
+    PRS_CalculerLesBornesDeToutesLesContraintes( Presolve, &NbModifications );
+  	# if TRACES == 1
+  	  if ( Pne->YaUneSolution != OUI_PNE ) printf("Probleme infaisable apres PRS_CalculerLesBornesDeToutesLesContraintes\n");
+  	# endif			
+  	if ( Pne->YaUneSolution != OUI_PNE ) break;
+    if ( NbModifications != 0 ) { Relancer = OUI_PNE; ReductionsEffectives |= PRS_REDUCTION_BORNES_DES_CONTRAINTES; }	    	
 	
-  PRS_ContraintesToujoursInactives( Presolve, &NbCntInact );
-	# if TRACES == 1
-	  if ( Pne->YaUneSolution != OUI_PNE ) printf("Probleme infaisable apres PRS_ContraintesToujoursInactives\n");
-	# endif			
-	if ( Pne->YaUneSolution != OUI_PNE ) break;
-  if ( NbCntInact != 0 ) Relancer = OUI_PNE;
+    PRS_ContraintesToujoursInactives( Presolve, &NbCntInact );
+  	# if TRACES == 1
+  	  if ( Pne->YaUneSolution != OUI_PNE ) printf("Probleme infaisable apres PRS_ContraintesToujoursInactives\n");
+  	# endif			
+  	if ( Pne->YaUneSolution != OUI_PNE ) break;
+    if ( NbCntInact != 0 ) { Relancer = OUI_PNE; ReductionsEffectives |= PRS_REDUCTION_BORNES_DES_CONTRAINTES; }
 	
-	PRS_AmeliorerLesBornes( Presolve, &BorneAmelioree );
-	# if TRACES == 1
-	  if ( Pne->YaUneSolution != OUI_PNE ) printf("Probleme infaisable apres PRS_AmeliorerLesBornes\n");
-	# endif		
- 	if ( Pne->YaUneSolution != OUI_PNE ) break;
-  if ( BorneAmelioree == OUI_PNE ) Relancer = OUI_PNE;	
+  	PRS_AmeliorerLesBornes( Presolve, &BorneAmelioree );
+  	# if TRACES == 1
+  	  if ( Pne->YaUneSolution != OUI_PNE ) printf("Probleme infaisable apres PRS_AmeliorerLesBornes\n");
+  	# endif		
+   	if ( Pne->YaUneSolution != OUI_PNE ) break;
+    if ( BorneAmelioree == OUI_PNE ) { Relancer = OUI_PNE; ReductionsEffectives |= PRS_REDUCTION_BORNES_DES_CONTRAINTES; }	
+  }
 	
-  PRS_BornerLesVariablesDualesNonBornees( Presolve, &NbModifications );
-	# if TRACES == 1
-	  if ( Pne->YaUneSolution != OUI_PNE ) printf("Probleme infaisable apres PRS_BornerLesVariablesDualesNonBornees\n");
-	# endif			
-  if ( Pne->YaUneSolution != OUI_PNE ) break;
-  if ( NbModifications != 0 ) Relancer = OUI_PNE;	
-
-	/* A verifier: il ne faut pas de subititution de variable ou si presolve uniquement */
-  PRS_VariablesDualesEtCoutsReduits( Presolve, &BorneAmelioree );
-	# if TRACES == 1
-	  if ( Pne->YaUneSolution != OUI_PNE ) printf("Probleme infaisable apres PRS_VariablesDualesEtCoutsReduits\n");
-	# endif			
-	if ( Pne->YaUneSolution != OUI_PNE ) break;
-  if ( BorneAmelioree == OUI_PNE ) Relancer = OUI_PNE;	
+  if ( ReductionsAFaire & PRS_REDUCTION_VARIABLES_DUALES ) {
+    PRS_BornerLesVariablesDualesNonBornees( Presolve, &NbModifications );
+  	# if TRACES == 1
+  	  if ( Pne->YaUneSolution != OUI_PNE ) printf("Probleme infaisable apres PRS_BornerLesVariablesDualesNonBornees\n");
+  	# endif			
+    if ( Pne->YaUneSolution != OUI_PNE ) break;
+    if ( NbModifications != 0 ) { Relancer = OUI_PNE; ReductionsEffectives |= PRS_REDUCTION_VARIABLES_DUALES; }	
+
+  	/* A verifier: il ne faut pas de subititution de variable ou si presolve uniquement */
+    PRS_VariablesDualesEtCoutsReduits( Presolve, &BorneAmelioree );
+  	# if TRACES == 1
+  	  if ( Pne->YaUneSolution != OUI_PNE ) printf("Probleme infaisable apres PRS_VariablesDualesEtCoutsReduits\n");
+  	# endif			
+  	if ( Pne->YaUneSolution != OUI_PNE ) break;
+    if ( BorneAmelioree == OUI_PNE ) { Relancer = OUI_PNE; ReductionsEffectives |= PRS_REDUCTION_VARIABLES_DUALES; }	
+  }
 		
   /* On regarde si on peut fixer des variables a l'aide de leurs couts: si une variable 
   n'intervient que dans des inegalites (ici toujours <) et que le signe de son cout et 
   le meme que ceux de ses coeff. dans les contraintes alors on peut fixer la variable 
   sur une de ses bornes */
 	
-  PRS_FixerVariablesSurCritere( Presolve, &VariableFixee );
-	# if TRACES == 1
-	  if ( Pne->YaUneSolution != OUI_PNE ) printf("Probleme infaisable apres PRS_FixerVariablesSurCritere\n");
-	# endif				
-	if ( Pne->YaUneSolution != OUI_PNE ) break;
-  if ( VariableFixee == OUI_PNE ) Relancer = OUI_PNE;	
+  if ( ReductionsAFaire & PRS_REDUCTION_FIXATION_SUR_CRITERE ) {
+    PRS_FixerVariablesSurCritere( Presolve, &VariableFixee );
+  	# if TRACES == 1
+  	  if ( Pne->YaUneSolution != OUI_PNE ) printf("Probleme infaisable apres PRS_FixerVariablesSurCritere\n");
+  	# endif				
+  	if ( Pne->YaUneSolution != OUI_PNE ) break;
+    if ( VariableFixee == OUI_PNE ) { Relancer = OUI_PNE; ReductionsEffectives |= PRS_REDUCTION_FIXATION_SUR_CRITERE; }	
+  }
 	
   /* Si une variable n'intervient pas dans les contraintes et n'est pas deja fixee on peut la 
      fixer sur une de ses bornes en fonction de son cout */		 
 	
- 	PRS_VariablesHorsContraintes( Presolve, &NbModifications );
-	# if TRACES == 1
-	  if ( Pne->YaUneSolution != OUI_PNE ) printf("Probleme infaisable apres PRS_VariablesHorsContraintes\n");
-	# endif		
-	if ( Pne->YaUneSolution != OUI_PNE ) break;
-  if ( NbModifications != 0 ) Relancer = OUI_PNE;
+  if ( ReductionsAFaire & PRS_REDUCTION_VARIABLES_HORS_CONTRAINTES ) {
+   	PRS_VariablesHorsContraintes( Presolve, &NbModifications );
+  	# if TRACES == 1
+  	  if ( Pne->YaUneSolution != OUI_PNE ) printf("Probleme infaisable apres PRS_VariablesHorsContraintes\n");
+  	# endif		
+  	if ( Pne->YaUneSolution != OUI_PNE ) break;
+    if ( NbModifications != 0 ) { Relancer = OUI_PNE; ReductionsEffectives |= PRS_REDUCTION_VARIABLES_HORS_CONTRAINTES; }
+  }
 			 
 	/* A mettre en service parce que ca marche */	
-  PRS_SubstituerVariables( Presolve, &NbModifications );
-	# if TRACES == 1
-	  if ( Pne->YaUneSolution != OUI_PNE ) printf("Probleme infaisable apres PRS_SubstituerVariables\n");
-	# endif			
-	if ( Pne->YaUneSolution != OUI_PNE ) break;
-  if ( NbModifications != 0 ) Relancer = OUI_PNE;	
+  if ( ReductionsAFaire & PRS_REDUCTION_SUBSTITUTION_DE_VARIABLES ) {
+    PRS_SubstituerVariables( Presolve, &NbModifications );
+  	# if TRACES == 1
+  	  if ( Pne->YaUneSolution != OUI_PNE ) printf("Probleme infaisable apres PRS_SubstituerVariables\n");
+  	# endif			
+  	if ( Pne->YaUneSolution != OUI_PNE ) break;
+    if ( NbModifications != 0 ) { Relancer = OUI_PNE; ReductionsEffectives |= PRS_REDUCTION_SUBSTITUTION_DE_VARIABLES; }	
+  }
 		
-	PRS_ContraintesColineaires( Presolve, &NbModifications );	
-	# if TRACES == 1
-	  if ( Pne->YaUneSolution != OUI_PNE ) printf("Probleme infaisable apres PRS_ContraintesColineaires\n");
-	# endif			
-	if ( Pne->YaUneSolution != OUI_PNE ) break;
-  if ( NbModifications != 0 ) Relancer = OUI_PNE;
+  if ( ReductionsAFaire & PRS_REDUCTION_CONTRAINTES_COLINEAIRES ) {
+  	PRS_ContraintesColineaires( Presolve, &NbModifications );	
+  	# if TRACES == 1
+  	  if ( Pne->YaUneSolution != OUI_PNE ) printf("Probleme infaisable apres PRS_ContraintesColineaires\n");
+  	# endif			
+  	if ( Pne->YaUneSolution != OUI_PNE ) break;
+    if ( NbModifications != 0 ) { Relancer = OUI_PNE; ReductionsEffectives |= PRS_REDUCTION_CONTRAINTES_COLINEAIRES; }
+  }
 
 	/* Si presolve uniquement par appel pendant un branch and bound: on ne supprime pas les colonnes colineaires */
-  if ( Pne->Controls != NULL ) {
-    if ( Pne->Controls->PresolveUniquement == OUI_PNE ) {
-	    NbModifications = 0;
-	  }
+  if ( ReductionsAFaire & PRS_REDUCTION_COLONNES_COLINEAIRES ) {
+    if ( Pne->Controls != NULL ) {
+      if ( Pne->Controls->PresolveUniquement == OUI_PNE ) {
+  	    NbModifications = 0;
+  	  }
+    }
+  	else {	
+  	  PRS_ColonnesColineaires( Presolve, &NbModifications );
+  	}
+  	# if TRACES == 1
+  	  if ( Pne->YaUneSolution != OUI_PNE ) printf("Probleme infaisable apres PRS_ColonnesColineaires\n");
+  	# endif			
+  	if ( Pne->YaUneSolution != OUI_PNE ) break;
+  	if ( NbModifications != 0 ) { Relancer = OUI_PNE; ReductionsEffectives |= PRS_REDUCTION_COLONNES_COLINEAIRES; }
+  }
+
+  if ( Sequence != NULL && Rejeu == NON_PNE ) {
+    /* Les contraintes colineaires exploitent les bornes des variables duales calculees dans le meme cycle */
+    if ( ReductionsEffectives & PRS_REDUCTION_CONTRAINTES_COLINEAIRES ) ReductionsEffectives |= PRS_REDUCTION_VARIABLES_DUALES;
+    Sequence->ReductionsDuCycle[NbCycles - 1] = ReductionsEffectives;
   }
-	else {	
-	  PRS_ColonnesColineaires( Presolve, &NbModifications );
-	}
-	# if TRACES == 1
-	  if ( Pne->YaUneSolution != OUI_PNE ) printf("Probleme infaisable apres PRS_ColonnesColineaires\n");
-	# endif			
-	if ( Pne->YaUneSolution != OUI_PNE ) break;
-	if ( NbModifications != 0 ) Relancer = OUI_PNE;
 	
 }
 
+/* Enregistrement de la sequence: les derniers cycles, qui n'ont rien modifie, ne servaient qu'a
+   constater qu'on ne pouvait plus reduire le probleme. On ne les rejouera pas. */
+if ( Sequence != NULL && Rejeu == NON_PNE && Pne->YaUneSolution == OUI_PNE ) {
+  Sequence->NombreDeCycles = NbCycles;
+  while ( Sequence->NombreDeCycles > 0 && Sequence->ReductionsDuCycle[Sequence->NombreDeCycles - 1] == 0 ) {
+    Sequence->NombreDeCycles--;
+  }
+  Sequence->NombreDeVariables = NombreDeVariablesInitial;
+  Sequence->NombreDeContraintes = NombreDeContraintesInitial;
+  Sequence->Enregistree = OUI_PNE;
+}
+
 /* Experimentalement on constate que ce type de transformation peut conduire a des
    imprecisions sur les coefficients des contraintes telles que parfois on peut
 	 se retrouver avec un probleme sans solution */
@@ -791,6 +791,12 @@ void LU_LibererMemoireLU( MATRICE * Matrice )
 {
 
 # ifdef LU_UTILISER_LES_OUTILS_DE_GESTION_MEMOIRE_PROPRIETAIRE	
+  # if VERBOSE_LU
+	{ long NombreDAllocations; long NombreDOctetsAlloues;
+    MEM_Statistiques( Matrice->Tas, &NombreDAllocations, &NombreDOctetsAlloues );
+	  printf(" Factorisation LU: %ld allocations  %ld octets\n",NombreDAllocations,NombreDOctetsAlloues);
+	}
+  # endif
   MEM_Quit( Matrice->Tas );
 	return;
 # endif
@@ -858,6 +864,8 @@ if ( Matrice->ContexteDeLaFactorisation == LU_POINT_INTERIEUR ) {
   free( Matrice->AdresseUGauche );
   free( Matrice->NombreDeTermesParLigneQueKpModifie );
   free( Matrice->IndexKpDeUouL );
+  free( Matrice->WRefactorisation );
+  free( Matrice->TRefactorisation );
 }
 
 # ifdef HYPER_CREUX
@@ -17,8 +17,9 @@
 # ifndef DEFINITIONS_CONSTANTES_INTERNES_LU_FAITE  
 /***********************************************************************************************************************/
     
+/* Les tableaux d'une factorisation sont pris dans une arene (voir mem_arene.c) liberee
+   en une seule fois avec la factorisation */
 # define LU_UTILISER_LES_OUTILS_DE_GESTION_MEMOIRE_PROPRIETAIRE 
-# undef LU_UTILISER_LES_OUTILS_DE_GESTION_MEMOIRE_PROPRIETAIRE
     
 # define VERBOSE_LU       0              
 # define VERBOSE_SCALING  0
@@ -61,6 +62,13 @@
   # define SEUIL_NB_SUPER_LIGNES_A_GROUPER   2
   # define SEUIL_1_NB_LIGNES_A_GROUPER       5   
   # define SEUIL_2_NB_LIGNES_A_GROUPER       2 
+
+  /* Calculs sur les colonnes denses des super lignes avec les instructions SSE2 (voir lu_super_lignes_noyaux.c) */
+  # if defined(__SSE2__) || defined(_M_X64) || ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 )
+    # define LU_NOYAUX_SSE2  1
+  # else
+    # define LU_NOYAUX_SSE2  0
+  # endif
 /* Fin super lignes */     
  
 # define PIVOT_MIN_SIMPLEXE          1.e-6  /*6*/           
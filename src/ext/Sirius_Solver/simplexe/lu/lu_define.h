@@ -307,6 +307,8 @@ int    *  NombreDeLignesQueKpModifie;   /* Nombre de lignes/colonnes */
 double ** AdresseUGauche;
 int    *  NombreDeTermesParLigneQueKpModifie;
 int       PremierKpParCalculClassique;  
+double *  WRefactorisation; /* Tableaux de travail de la refactorisation, alloues au premier appel */
+char   *  TRefactorisation; /* et conserves d'une iteration a l'autre */
 
 /* Stockage du pointeur vers la matrice d'entree */
 MATRICE_A_FACTORISER * MatriceEntree;
@@ -333,7 +333,7 @@ void LU_EliminationDUneLigneMatricePleineCasSymetrique( MATRICE * Matrice , int
 {
 int il; int ic; int ilL; double X; int ilDebLignePivot; int ilColonnePivot; int ilElm;
 int * IndiceColonne; double UnSurValeurDuPivot; int NbTermesLignePivot; int Ligne; int NbTermesColonnePivot; 
-double * ElmDeL; int * IndiceLigneDeL; int CapaciteDesColonnes; int i; int NombreDeLignesDeLaSuperLigne;
+double * ElmDeL; int * IndiceLigneDeL; int CapaciteDesColonnes; int NombreDeLignesDeLaSuperLigne;
 int NumeroDeColonne; char Contexte; int icDebColonnePivot; double * ElmColonneDeSuperLigne;
 int * NumerosDesLignesDeLaSuperLigne; int NombreDeTermesDeLaSuperLigne;
 double * ValeurDesTermesDeColonnePivot; int k; int NombreDeLignesRestantes;
@@ -429,9 +429,8 @@ for ( il = 0 ; il < NbTermesLignePivot ; il++ , ilElm++ ) {
   
   /* Calcul du terme modifie: on balaye la colonne de la SuperLigne */
   ic = CapaciteDesColonnes * il;  
-  for ( i = 0 ; i < NombreDeLignesDeLaSuperLigne ; i++ , ic++ ) {
-    ElmColonneDeSuperLigne[ic]-= X * ValeurDesTermesDeColonnePivot[i]; 
-  }             
+  LU_SuperLigneSoustraireColonnePivot( &ElmColonneDeSuperLigne[ic], X, ValeurDesTermesDeColonnePivot,
+                                       NombreDeLignesDeLaSuperLigne );
 }
 
 Matrice->IndexLibreDeL = ilL;
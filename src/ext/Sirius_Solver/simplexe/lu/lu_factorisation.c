@@ -40,7 +40,7 @@ int FaireScalingDeLaMatrice; MATRICE * Matrice; void * Tas            ;
 double SeuilDePivotage      ; int NombreDeChangementsDeSeuilDePivotage;
 
 # ifdef LU_UTILISER_LES_OUTILS_DE_GESTION_MEMOIRE_PROPRIETAIRE	
-  Tas = MEM_Init(); 
+  Tas = MEM_InitArene(); 
   Matrice = (MATRICE *) MEM_Malloc ( Tas, sizeof( MATRICE ) );
   if ( Matrice == NULL ) {
     printf("Saturation memoire, impossible d'allouer un objet MATRICE\n");  
@@ -110,7 +110,7 @@ if ( Matrice->AnomalieDetectee != NON_LU ) {
          LU_LibererMemoireLU( Matrice );
 
          # ifdef LU_UTILISER_LES_OUTILS_DE_GESTION_MEMOIRE_PROPRIETAIRE	
-           Tas = MEM_Init(); 
+           Tas = MEM_InitArene(); 
            Matrice = (MATRICE *) MEM_Malloc ( Tas, sizeof( MATRICE ) );
            if ( Matrice == NULL ) {
              printf("Saturation memoire, impossible d'allouer un objet MATRICE\n");  
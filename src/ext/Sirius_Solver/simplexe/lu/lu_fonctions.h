@@ -102,6 +102,10 @@ void LU_DetectionSuperLignes( MATRICE * , char * );
 void LU_ScanSuperLigne( MATRICE * , SUPER_LIGNE_DE_LA_MATRICE * , int , int , double * , unsigned int * );											
 								 
 void LU_ScanSuperLigneCasSymetrique( MATRICE * , SUPER_LIGNE_DE_LA_MATRICE * , int , int , double * , unsigned int * );
+
+void LU_SuperLigneSoustraireColonnePivot( double * , double , double * , int );
+
+void LU_SuperLigneInitialiserColonne( double * , double , double * , int );
 																					 			       
 SUPER_LIGNE_DE_LA_MATRICE * LU_CreerUneSuperLigne( MATRICE * , int * , int , int * , int );
 
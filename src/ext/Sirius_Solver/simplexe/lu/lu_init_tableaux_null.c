@@ -144,6 +144,8 @@ Matrice->DebutInfosLignesQueKpModifie   = NULL;
 Matrice->NombreDeLignesQueKpModifie     = NULL;
 Matrice->AdresseUGauche                 = NULL;
 Matrice->NombreDeTermesParLigneQueKpModifie = NULL;
+Matrice->WRefactorisation                   = NULL;
+Matrice->TRefactorisation                   = NULL;
 
 Matrice->SecondMembreSV = NULL; 
 Matrice->SolutionSV     = NULL;
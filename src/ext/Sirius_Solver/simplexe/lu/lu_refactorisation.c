@@ -193,15 +193,22 @@ goto RecopieDuTriangleU;
 
 CompleterLaFactorisation:
 /* On complete la factorisation par la methode classique */
-W = NULL;
-T = NULL;
-W = (double *) malloc( Rang * sizeof( double ) );
-T = (char *)   malloc( Rang * sizeof( char   ) );
-if ( W == NULL || T == NULL ) {
-  free( W ); W = NULL; free( T ); T = NULL; 
-  *Erreur = OUI_LU;
-  goto FinRefactorisation;
-} 
+/* Les tableaux de travail sont conserves d'un appel a l'autre: le point interieur refactorise
+   a chaque iteration et, en mode arene, un free ne rend pas la place */
+if ( Matrice->WRefactorisation == NULL || Matrice->TRefactorisation == NULL ) {
+  free( Matrice->WRefactorisation ); Matrice->WRefactorisation = NULL;
+  free( Matrice->TRefactorisation ); Matrice->TRefactorisation = NULL;
+  Matrice->WRefactorisation = (double *) malloc( Rang * sizeof( double ) );
+  Matrice->TRefactorisation = (char *)   malloc( Rang * sizeof( char   ) );
+  if ( Matrice->WRefactorisation == NULL || Matrice->TRefactorisation == NULL ) {
+    free( Matrice->WRefactorisation ); Matrice->WRefactorisation = NULL;
+    free( Matrice->TRefactorisation ); Matrice->TRefactorisation = NULL;
+    *Erreur = OUI_LU;
+    goto FinRefactorisation;
+  }
+}
+W = Matrice->WRefactorisation;
+T = Matrice->TRefactorisation;
 memset( T , 0 , Rang * sizeof( char ) );
 
 for ( ; Kp < Rang ; Kp++ ) {
@@ -261,8 +268,6 @@ for ( ; Kp < Rang ; Kp++ ) {
     }
 	}
 }
-free( W );
-free( T );
 W = NULL;
 T = NULL;
 
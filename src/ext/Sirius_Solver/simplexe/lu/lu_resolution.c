@@ -25,6 +25,10 @@
 # include "lu_define.h"
 # include "lu_fonctions.h"
 
+# ifdef LU_UTILISER_LES_OUTILS_DE_GESTION_MEMOIRE_PROPRIETAIRE	
+  # include "lu_memoire.h"
+# endif
+
 /*--------------------------------------------------------------------------------------------------*/
  
 void LU_LuSolv( MATRICE * Matrice,
@@ -73,9 +73,8 @@ for ( il = 0 ; il < NombreDeTermes ; il++ ) {
     /* Calcul du terme modifie: on balaye la colonne de la SuperLigne */
     ic = CapaciteDesColonnes * il;  
     X  = W[Colonne];    
-    for ( i = 0 ; i < NombreDeLignesDeLaSuperLigne ; i++ , ic++ ) {
-      ElmColonneDeSuperLigne[ic]-= X * ValeurDesTermesDeColonnePivot[i]; 
-    }            
+    LU_SuperLigneSoustraireColonnePivot( &ElmColonneDeSuperLigne[ic], X, ValeurDesTermesDeColonnePivot,
+                                         NombreDeLignesDeLaSuperLigne );
     /* Comme il y a deja un terme dans la ligne scannee, il n'y a pas de "fill-in" a cet endroit */
     f--;
     if ( f == 0 ) goto ControleFillIn;  
@@ -119,9 +118,8 @@ if ( f > 0 ) {
          dans la SuperLigne scannee: on a trouve un "fill-in" */
       X = W[Colonne];    
       ic = CapaciteDesColonnes * NombreDeTermes;
-      for ( i = 0 ; i < NombreDeLignesDeLaSuperLigne ; i++ , ic++ ) {
-        ElmColonneDeSuperLigne[ic] = -X * ValeurDesTermesDeColonnePivot[i];	
-      }
+      LU_SuperLigneInitialiserColonne( &ElmColonneDeSuperLigne[ic], -X, ValeurDesTermesDeColonnePivot,
+                                       NombreDeLignesDeLaSuperLigne );
       IndiceColonne[NombreDeTermes] = Colonne;
       NombreDeTermes++;
 
@@ -0,0 +1,95 @@
+/*
+** Copyright 2007-2018 RTE
+**
+** This file is part of Sirius_Solver.
+** This program and the accompanying materials are made available under the
+** terms of the Eclipse Public License 2.0 which is available at
+** http://www.eclipse.org/legal/epl-2.0.
+**
+** This Source Code may also be made available under the following Secondary
+** Licenses when the conditions for such availability set forth in the Eclipse
+** Public License, v. 2.0 are satisfied: GNU General Public License, version 3
+** or later, which is available at <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: EPL-2.0 OR GPL-3.0
+*/
+/***********************************************************************
+
+   FONCTION: Decomposition LU de la base. Noyaux de calcul sur les
+             colonnes d'une SuperLigne.
+             Les colonnes d'une SuperLigne sont stockees de facon dense
+             (une valeur par ligne de la SuperLigne): on les traite
+             4 valeurs par 4 valeurs (2 registres SSE2 de 2 valeurs),
+             les dernieres valeurs etant traitees une par une.
+             Chaque valeur est calculee exactement comme dans la
+             version scalaire (pas de FMA), le resultat ne depend donc
+             pas du chemin utilise.
+
+************************************************************************/
+
+# include "lu_define.h"
+# include "lu_fonctions.h"
+
+# if LU_NOYAUX_SSE2
+  # include <emmintrin.h>
+# endif
+
+/*--------------------------------------------------------------------------------------------------*/
+/* Colonne = Colonne - X * ValeurDesTermesDeColonnePivot */
+
+void LU_SuperLigneSoustraireColonnePivot( double * Colonne, double X,
+                                          double * ValeurDesTermesDeColonnePivot,
+                                          int NombreDeLignesDeLaSuperLigne )
+{
+int i;
+# if LU_NOYAUX_SSE2
+__m128d Xv; __m128d A; __m128d B;
+# endif
+
+i = 0;
+
+# if LU_NOYAUX_SSE2
+Xv = _mm_set1_pd( X );
+for ( ; i + 4 <= NombreDeLignesDeLaSuperLigne ; i+= 4 ) {
+  A = _mm_mul_pd( Xv, _mm_loadu_pd( &ValeurDesTermesDeColonnePivot[i] ) );
+  B = _mm_mul_pd( Xv, _mm_loadu_pd( &ValeurDesTermesDeColonnePivot[i+2] ) );
+  _mm_storeu_pd( &Colonne[i]  , _mm_sub_pd( _mm_loadu_pd( &Colonne[i]   ), A ) );
+  _mm_storeu_pd( &Colonne[i+2], _mm_sub_pd( _mm_loadu_pd( &Colonne[i+2] ), B ) );
+}
+# endif
+
+for ( ; i < NombreDeLignesDeLaSuperLigne ; i++ ) {
+  Colonne[i]-= X * ValeurDesTermesDeColonnePivot[i];
+}
+
+return;
+}
+
+/*--------------------------------------------------------------------------------------------------*/
+/* Colonne = X * ValeurDesTermesDeColonnePivot (terme cree par "fill-in") */
+
+void LU_SuperLigneInitialiserColonne( double * Colonne, double X,
+                                      double * ValeurDesTermesDeColonnePivot,
+                                      int NombreDeLignesDeLaSuperLigne )
+{
+int i;
+# if LU_NOYAUX_SSE2
+__m128d Xv;
+# endif
+
+i = 0;
+
+# if LU_NOYAUX_SSE2
+Xv = _mm_set1_pd( X );
+for ( ; i + 4 <= NombreDeLignesDeLaSuperLigne ; i+= 4 ) {
+  _mm_storeu_pd( &Colonne[i]  , _mm_mul_pd( Xv, _mm_loadu_pd( &ValeurDesTermesDeColonnePivot[i]   ) ) );
+  _mm_storeu_pd( &Colonne[i+2], _mm_mul_pd( Xv, _mm_loadu_pd( &ValeurDesTermesDeColonnePivot[i+2] ) ) );
+}
+# endif
+
+for ( ; i < NombreDeLignesDeLaSuperLigne ; i++ ) {
+  Colonne[i] = X * ValeurDesTermesDeColonnePivot[i];
+}
+
+return;
+}
@@ -197,6 +197,10 @@
                                                      des variables basiques a surveiller */
 																										 
 # define FAIRE_UN_BRUITAGE_INITIAL_DES_COUTS OUI_SPX
+
+/* Pricing parallele (voir NombreDeThreadsDePricing): en dessous de ce nombre de variables hors base,
+   ou de variables a tester dans le test du ratio, le calcul reste sequentiel */
+# define SEUIL_POUR_PRICING_PARALLELE 10000
 																										 
 /*******************************************************************************************/
 # define DEFINITIONS_CONSTANTES_INTERNES_SPX_FAITE  
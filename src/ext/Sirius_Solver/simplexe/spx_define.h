@@ -95,6 +95,7 @@ char   TypeDePricing; /* PRICING_DANTZIG ou PRICING_STEEPEST_EDGE */
 char   FaireDuScalingSPX;
 char   StrategieAntiDegenerescence; /* AGRESSIF ou PEU_AGRESSIF */
 int   CycleDeControleDeDegenerescence;
+int   NombreDeThreadsDePricing; /* 1: calcul de NBarreR et test du ratio sequentiels */
 
 char   EcrireLegendePhase1;
 char   EcrireLegendePhase2;    
@@ -171,6 +171,12 @@ typedef struct {
                                             a NombreDeContraintes + NombreDeContraintesCoupes */
   double * CoutsReduits; /* Couts reduits des variables hors-base, longueur nombre de variables passees 
                             en entree du probleme. Contient la valeur 0 si la variable est basique */
+  /* Parallelisme */
+  int    NombreDeThreadsDePricing; /* Nombre de threads utilises par l'algorithme dual pour le calcul de la ligne pivot
+                                      (NBarreR) et pour le test du ratio. Mettre 1 pour un calcul sequentiel.
+                                      N'a d'effet que si le simplexe a ete compile avec OpenMP et sur les problemes de
+                                      grande taille. Le resultat ne depend pas du nombre de threads (mais il peut
+                                      differer, aux arrondis pres, de celui du calcul sequentiel) */
   /* Traces */
   char     AffichageDesTraces; /* Vaut OUI_SPX ou NON_SPX */ 
 				    
@@ -39,7 +39,7 @@ double * ErBMoinsUn; double * NBarreR; int * Cdeb; int * CNbTerm; double * ACol;
 int * NumeroDeContrainte; int Cnt; int * Mdeb; int * NbTerm; int * Indcol; double * A;
 int NombreDeVariablesHorsBase; int NombreDeVariables; char Methode; int Var;
 char * PositionDeLaVariable; int * NombreDeVariablesHorsBaseDeLaContrainte;
-int * IndicesDeLigne; int * LigneDeLaBaseFactorisee;
+int * IndicesDeLigne; int * LigneDeLaBaseFactorisee; int NombreDeThreads;
 
 NombreDeContraintes         = Spx->NombreDeContraintes;   
 ErBMoinsUn                  = Spx->ErBMoinsUn; 
@@ -65,6 +65,14 @@ else {
   }
 }
 
+/* Calcul partage entre plusieurs threads: seule la methode 2 s'y prete car chaque terme de NBarreR
+   y est calcule independamment des autres. Le resultat ne depend donc pas du nombre de threads. */
+NombreDeThreads = 1;
+# ifdef _OPENMP
+  if ( NombreDeVariablesHorsBase >= SEUIL_POUR_PRICING_PARALLELE ) NombreDeThreads = Spx->NombreDeThreadsDePricing;
+# endif
+if ( NombreDeThreads > 1 ) Methode = 2;
+
 /* 2 methodes de calcul des produits scalaires */
 
 if ( Methode == 1 ) {
@@ -101,6 +109,9 @@ else {
     IndicesDeLigne = Spx->IndicesDeLigneDesTermesDuProblemeReduit;
     ACol = Spx->ValeurDesTermesDesColonnesDuProblemeReduit;			
 	  LigneDeLaBaseFactorisee = Spx->LigneDeLaBaseFactorisee;
+    # ifdef _OPENMP
+      # pragma omp parallel for private(Var,il,ilMax,X) schedule(static) num_threads(NombreDeThreads) if(NombreDeThreads > 1)
+    # endif
     for ( i = 0 ; i < NombreDeVariablesHorsBase ; i++ ) {
 	    Var = NumerosDesVariablesHorsBase[i];
       il    = Cdeb[Var];				
@@ -119,6 +130,9 @@ else {
     NumeroDeContrainte = Spx->NumeroDeContrainte;
     ACol = Spx->ACol;
 
+    # ifdef _OPENMP
+      # pragma omp parallel for private(Var,il,ilMax,X) schedule(static) num_threads(NombreDeThreads) if(NombreDeThreads > 1)
+    # endif
     for ( i = 0 ; i < NombreDeVariablesHorsBase ; i++ ) {
 	    Var = NumerosDesVariablesHorsBase[i];
       il    = Cdeb[Var];				
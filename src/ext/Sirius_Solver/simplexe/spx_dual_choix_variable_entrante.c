@@ -41,6 +41,9 @@
 int SPX_PartitionTriRapide( PROBLEME_SPX * , double * , int , int , char );
 void SPX_TriRapide( PROBLEME_SPX * , double * , int , int , char );
 void SPX_DualTestDuRatioChoixDeLaVariableEntrante( PROBLEME_SPX * , int * );
+# ifdef _OPENMP
+  int SPX_DualTestDuRatioSansTriEnParallele( PROBLEME_SPX * , int * , int );
+# endif
 
 /*----------------------------------------------------------------------------*/
 int SPX_PartitionTriRapide( PROBLEME_SPX * Spx , double * Tableau , int Deb, int Fin , char TypeDeTri )
@@ -91,6 +94,84 @@ if ( Debut < Fin ) {
 return;
 }
 
+/*----------------------------------------------------------------------------*/
+# ifdef _OPENMP
+/* Test du ratio sans tri prealable partage entre plusieurs threads. Chaque thread cherche le meilleur
+   candidat de sa tranche de variables a tester, puis on retient le meilleur des threads en departageant
+   les ex aequo par le plus petit indice: le choix est le meme que celui du calcul sequentiel.
+   Retourne l'indice choisi dans la liste des variables a tester ou -1 */
+
+int SPX_DualTestDuRatioSansTriEnParallele( PROBLEME_SPX * Spx , int * NumerosDesVariables , int NombreDeThreads )
+{
+int j; int i; int Var; int NombreDeVariablesATester; int jChoisi; int jChoisiThread; double SeuilHarris;
+double SeuilHarrisThread; double NBarreRMx; double NBarreRMxThread; double * CBarreSurNBarreRAvecTolerance;
+int * NumeroDesVariableATester; double * CBarreSurNBarreR; double * NBarreR;
+
+NombreDeVariablesATester      = Spx->NombreDeVariablesATester;
+CBarreSurNBarreRAvecTolerance = Spx->CBarreSurNBarreRAvecTolerance;
+NumeroDesVariableATester      = Spx->NumeroDesVariableATester;
+CBarreSurNBarreR              = Spx->CBarreSurNBarreR;
+NBarreR                       = Spx->NBarreR;
+
+/* Seuil de Harris */
+SeuilHarris = LINFINI_SPX;
+jChoisi     = -1;
+# pragma omp parallel private(j,SeuilHarrisThread,jChoisiThread) num_threads(NombreDeThreads)
+{
+  SeuilHarrisThread = LINFINI_SPX;
+  jChoisiThread     = -1;
+  # pragma omp for schedule(static) nowait
+  for ( j = 0 ; j < NombreDeVariablesATester ; j++ ) {
+    if ( CBarreSurNBarreRAvecTolerance[j] < SeuilHarrisThread ) {
+      SeuilHarrisThread = CBarreSurNBarreRAvecTolerance[j];
+      jChoisiThread     = j;
+    }
+  }
+  # pragma omp critical
+  {
+    if ( jChoisiThread >= 0 ) {
+      if ( SeuilHarrisThread < SeuilHarris || ( SeuilHarrisThread == SeuilHarris && jChoisiThread < jChoisi ) ) {
+        SeuilHarris = SeuilHarrisThread;
+        jChoisi     = jChoisiThread;
+      }
+    }
+  }
+}
+
+if ( jChoisi < 0 ) return( -1 );
+
+/* Plus grand pivot parmi les variables dont le rapport est inferieur au seuil de Harris */
+jChoisi   = -1;
+NBarreRMx = -LINFINI_SPX;
+# pragma omp parallel private(j,i,Var,NBarreRMxThread,jChoisiThread) num_threads(NombreDeThreads)
+{
+  NBarreRMxThread = -LINFINI_SPX;
+  jChoisiThread   = -1;
+  # pragma omp for schedule(static) nowait
+  for ( j = 0 ; j < NombreDeVariablesATester ; j++ ) {
+    if ( CBarreSurNBarreR[j] > SeuilHarris ) continue;
+    i = NumeroDesVariableATester[j];
+    if ( i < 0 ) continue;
+    Var = NumerosDesVariables[i];
+    if ( fabs( NBarreR[Var] ) > NBarreRMxThread ) {
+      NBarreRMxThread = fabs( NBarreR[Var] );
+      jChoisiThread   = j;
+    }
+  }
+  # pragma omp critical
+  {
+    if ( jChoisiThread >= 0 ) {
+      if ( NBarreRMxThread > NBarreRMx || ( NBarreRMxThread == NBarreRMx && jChoisiThread < jChoisi ) ) {
+        NBarreRMx = NBarreRMxThread;
+        jChoisi   = jChoisiThread;
+      }
+    }
+  }
+}
+
+return( jChoisi );
+}
+# endif
 /*----------------------------------------------------------------------------*/
 
 void SPX_DualTestDuRatioChoixDeLaVariableEntrante( PROBLEME_SPX * Spx , int * i0Harris )
@@ -140,6 +221,20 @@ if ( Spx->FaireTriRapide == OUI_SPX ) {
 
 /* On a pas fait de tri prealable */
 
+# ifdef _OPENMP
+  if ( NombreDeVariablesATester >= SEUIL_POUR_PRICING_PARALLELE && Spx->NombreDeThreadsDePricing > 1 ) {
+    jChoisi = SPX_DualTestDuRatioSansTriEnParallele( Spx , NumerosDesVariables , Spx->NombreDeThreadsDePricing );
+    if ( jChoisi >= 0 ) {
+      Spx->VariableEntrante = NumerosDesVariables[NumeroDesVariableATester[jChoisi]];
+      CBarreSurNBarreR             [jChoisi] = CBarreSurNBarreR[NombreDeVariablesATester-1];
+      CBarreSurNBarreRAvecTolerance[jChoisi] = CBarreSurNBarreRAvecTolerance[NombreDeVariablesATester-1];
+      NumeroDesVariableATester     [jChoisi] = NumeroDesVariableATester[NombreDeVariablesATester-1];
+      Spx->NombreDeVariablesATester--;
+    }
+    return;
+  }
+# endif
+
 SeuilHarris = LINFINI_SPX;
 jChoisi     = -1;
 for ( j = 0 ; j < NombreDeVariablesATester ; j++ ) {	
@@ -101,6 +101,9 @@ CoutsReduits                 = Probleme->CoutsReduits;
 
 Spx->AffichageDesTraces = Probleme->AffichageDesTraces;
 
+Spx->NombreDeThreadsDePricing = Probleme->NombreDeThreadsDePricing;
+if ( Spx->NombreDeThreadsDePricing < 1 ) Spx->NombreDeThreadsDePricing = 1;
+
 Spx->NbCycles = 0;
 
 Spx->TypeDePricing = (char) Probleme->TypeDePricing;
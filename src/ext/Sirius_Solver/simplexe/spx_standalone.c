@@ -152,6 +152,7 @@ for ( j = 0 ; j < 1 ; j++ ) { /* Pour tester les fuites memoire on enchaine les
 	probleme.AffichageDesTraces                    = OUI_SPX;
 	probleme.CoutMax                               = -1;
 	probleme.UtiliserCoutMax                       = NON_SPX;
+	probleme.NombreDeThreadsDePricing              = 1;
 
 	probleme.Contexte		                       = SIMPLEXE_SEUL;
 	probleme.BaseDeDepartFournie	               = NON_SPX ;
@@ -0,0 +1,336 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+
+#include "matrix-cache.h"
+#include <yuni/io/file.h>
+#include <yuni/io/directory.h>
+#include <yuni/thread/id.h>
+#include <cstring>
+#include <cstdio>
+#ifdef YUNI_OS_WINDOWS
+# include <yuni/core/system/windows.hdr.h>
+# include <yuni/core/string/wstring.h>
+#else
+# include <sys/types.h>
+# include <sys/stat.h>
+# include <sys/mman.h>
+# include <fcntl.h>
+# include <unistd.h>
+#endif
+#include "../logs.h"
+#include "../io/statistics.h"
+
+using namespace Yuni;
+
+
+namespace Antares
+{
+
+	namespace // anonymous
+	{
+
+		static const char cacheMagic[8] = { 'A', 'N', 'T', 'M', 'T', 'R', 'X', '\0' };
+
+		enum
+		{
+			cacheVersion = 1,
+			cacheAlignment = 8,
+		};
+
+		//! Header of a cache file, followed by the source filename and the columns
+		struct CacheHeader final
+		{
+			char magic[8];
+			uint32 version;
+			uint32 signature;
+			uint32 minWidth;
+			uint32 maxHeight;
+			uint32 fixedSize;
+			uint32 width;
+			uint32 height;
+			uint32 sourceLength;
+			uint64 sourceSize;
+			sint64 sourceModification;
+		};
+
+
+		static inline uint64 DataOffset(uint sourceLength)
+		{
+			uint64 offset = sizeof(CacheHeader) + sourceLength;
+			return (offset + cacheAlignment - 1) & ~((uint64) cacheAlignment - 1);
+		}
+
+	} // anonymous namespace
+
+
+
+
+	YString MatrixCache::pFolder;
+
+
+
+	MatrixCache::Mapping::Mapping() :
+		width(0),
+		height(0),
+		pAddress(nullptr),
+		pSize(0),
+		pDataOffset(0),
+		pTypeSize(0)
+		# ifdef YUNI_OS_WINDOWS
+		, pFileHandle(nullptr)
+		, pMappingHandle(nullptr)
+		# endif
+	{}
+
+
+	MatrixCache::Mapping::~Mapping()
+	{
+		close();
+	}
+
+
+	void MatrixCache::Mapping::close()
+	{
+		if (pAddress)
+		{
+			# ifdef YUNI_OS_WINDOWS
+			::UnmapViewOfFile(pAddress);
+			::CloseHandle((HANDLE) pMappingHandle);
+			::CloseHandle((HANDLE) pFileHandle);
+			pMappingHandle = nullptr;
+			pFileHandle = nullptr;
+			# else
+			::munmap(pAddress, (size_t) pSize);
+			# endif
+			pAddress = nullptr;
+		}
+		pSize = 0;
+		width = 0;
+		height = 0;
+	}
+
+
+	const void* MatrixCache::Mapping::column(uint x) const
+	{
+		assert(pAddress and x < width);
+		return (const char*) pAddress + pDataOffset + (uint64) x * height * pTypeSize;
+	}
+
+
+
+
+	void MatrixCache::Folder(const AnyString& folder)
+	{
+		pFolder = folder;
+		if (not pFolder.empty() and not IO::Directory::Create(pFolder))
+		{
+			logs.error() << "impossible to create the matrix cache folder " << pFolder;
+			pFolder.clear();
+		}
+	}
+
+
+	bool MatrixCache::Enabled()
+	{
+		return not pFolder.empty();
+	}
+
+
+	uint MatrixCache::TypeSignature(uint typeSize, bool decimal, uint readWriteTypeSize, bool readWriteDecimal)
+	{
+		return (typeSize & 0xFF) | (decimal ? 0x100 : 0)
+			| ((readWriteTypeSize & 0xFF) << 16) | (readWriteDecimal ? 0x1000000 : 0);
+	}
+
+
+	void MatrixCache::CacheFilename(YString& out, const AnyString& source)
+	{
+		// FNV-1a
+		uint64 hash = 14695981039346656037ULL;
+		for (uint i = 0; i != source.size(); ++i)
+		{
+			hash ^= (unsigned char) source[i];
+			hash *= 1099511628211ULL;
+		}
+
+		char name[24];
+		snprintf(name, sizeof(name), "%016llx", (unsigned long long) hash);
+		out.clear() << pFolder << IO::Separator << (const char*) name << ".matrix";
+	}
+
+
+	bool MatrixCache::Open(Mapping& out, const AnyString& source, uint signature, uint typeSize,
+		uint minWidth, uint maxHeight, bool fixedSize)
+	{
+		out.close();
+		if (pFolder.empty())
+			return false;
+
+		uint64 sourceSize;
+		if (not IO::File::Size(source, sourceSize))
+			return false;
+		const sint64 sourceModification = IO::File::LastModificationTime(source);
+
+		YString filename;
+		CacheFilename(filename, source);
+
+		// Mapping the whole file
+		# ifdef YUNI_OS_WINDOWS
+		{
+			WString wfilename(filename);
+			HANDLE hFile = ::CreateFileW(wfilename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+				OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if (hFile == INVALID_HANDLE_VALUE)
+				return false;
+			LARGE_INTEGER size;
+			HANDLE hMapping = (::GetFileSizeEx(hFile, &size) and size.QuadPart > 0)
+				? ::CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+			void* address = (hMapping) ? ::MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+			if (not address)
+			{
+				if (hMapping)
+					::CloseHandle(hMapping);
+				::CloseHandle(hFile);
+				return false;
+			}
+			out.pFileHandle    = hFile;
+			out.pMappingHandle = hMapping;
+			out.pAddress       = address;
+			out.pSize          = (uint64) size.QuadPart;
+		}
+		# else
+		{
+			int fd = ::open(filename.c_str(), O_RDONLY);
+			if (fd < 0)
+				return false;
+			struct stat st;
+			void* address = (0 == ::fstat(fd, &st) and st.st_size > 0)
+				? ::mmap(nullptr, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+			::close(fd);
+			if (address == MAP_FAILED)
+				return false;
+			out.pAddress = address;
+			out.pSize    = (uint64) st.st_size;
+		}
+		# endif
+
+		// Checking the header
+		CacheHeader header;
+		bool valid = (out.pSize >= sizeof(CacheHeader));
+		if (valid)
+		{
+			memcpy(&header, out.pAddress, sizeof(CacheHeader));
+			const uint64 dataOffset = DataOffset(header.sourceLength);
+			valid = 0 == memcmp(header.magic, cacheMagic, sizeof(cacheMagic))
+				and header.version == (uint32) cacheVersion
+				and header.signature == signature
+				and header.minWidth == minWidth
+				and header.maxHeight == maxHeight
+				and header.fixedSize == (fixedSize ? 1u : 0u)
+				and header.sourceSize == sourceSize
+				and header.sourceModification == sourceModification
+				and header.sourceLength == source.size()
+				and out.pSize >= dataOffset + (uint64) header.width * header.height * typeSize
+				and 0 == memcmp((const char*) out.pAddress + sizeof(CacheHeader), source.c_str(), source.size());
+			if (valid)
+			{
+				out.width       = header.width;
+				out.height      = header.height;
+				out.pDataOffset = dataOffset;
+				out.pTypeSize   = typeSize;
+			}
+		}
+		if (not valid)
+		{
+			out.close();
+			return false;
+		}
+
+		// IO statistics
+		Statistics::HasReadFromDisk(out.pSize);
+		return true;
+	}
+
+
+	void MatrixCache::WriteHeader(Clob& out, const AnyString& source, uint signature,
+		uint minWidth, uint maxHeight, bool fixedSize, uint width, uint height)
+	{
+		CacheHeader header;
+		memset(&header, 0, sizeof(CacheHeader));
+		memcpy(header.magic, cacheMagic, sizeof(cacheMagic));
+		header.version    = (uint32) cacheVersion;
+		header.signature  = signature;
+		header.minWidth   = minWidth;
+		header.maxHeight  = maxHeight;
+		header.fixedSize  = fixedSize ? 1u : 0u;
+		header.width      = width;
+		header.height     = height;
+		header.sourceLength = source.size();
+		if (not IO::File::Size(source, header.sourceSize))
+			header.sourceSize = (uint64) -1; // will never match
+		header.sourceModification = IO::File::LastModificationTime(source);
+
+		out.clear();
+		out.append((const char*) &header, (uint) sizeof(CacheHeader));
+		out.append(source.c_str(), source.size());
+		while (out.size() < DataOffset(source.size()))
+			out += '\0';
+	}
+
+
+	bool MatrixCache::Save(const AnyString& source, const Clob& content)
+	{
+		if (pFolder.empty())
+			return false;
+
+		YString filename;
+		CacheFilename(filename, source);
+
+		// Written under a temporary name first, to never map a partial file
+		YString tmp;
+		tmp << filename << '.' << (uint64) Thread::ID() << ".tmp";
+		if (not IO::File::SetContent(tmp, content))
+		{
+			IO::File::Delete(tmp);
+			return false;
+		}
+		# ifdef YUNI_OS_WINDOWS
+		IO::File::Delete(filename);
+		# endif
+		if (0 != ::rename(tmp.c_str(), filename.c_str()))
+		{
+			IO::File::Delete(tmp);
+			return false;
+		}
+		Statistics::HasWrittenToDisk(content.size());
+		return true;
+	}
+
+
+
+
+} // namespace Antares
@@ -0,0 +1,153 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#ifndef __ANTARES_LIBS_ARRAY_MATRIX_CACHE_H__
+# define __ANTARES_LIBS_ARRAY_MATRIX_CACHE_H__
+
+# include <yuni/yuni.h>
+# include <yuni/core/string.h>
+
+
+
+namespace Antares
+{
+
+	/*!
+	** \brief Binary cache for the matrices loaded from CSV files
+	**
+	** When a folder is given, each matrix successfully loaded from a CSV file is
+	** also written, already converted, into a binary file of this folder (one
+	** block per column). The next loadings of the same CSV file map this binary
+	** file in memory instead of parsing the text again, as long as the size and
+	** the modification time of the source file, and the loading parameters
+	** (type, expected size...) are the same.
+	**
+	** Disabled by default.
+	*/
+	class MatrixCache final
+	{
+	public:
+		/*!
+		** \brief A cache file mapped in memory (read-only)
+		*/
+		class Mapping final
+		{
+		public:
+			//! Default constructor
+			Mapping();
+			//! Destructor (unmap the file)
+			~Mapping();
+
+			//! Get the raw values of a column (`height` values)
+			const void* column(uint x) const;
+
+			//! Unmap the file
+			void close();
+
+		public:
+			//! Width of the matrix
+			uint width;
+			//! Height of the matrix
+			uint height;
+
+		private:
+			//! Base address of the mapping
+			void* pAddress;
+			//! Size of the mapping
+			Yuni::uint64 pSize;
+			//! Offset of the first column
+			Yuni::uint64 pDataOffset;
+			//! Size in bytes of a single value
+			uint pTypeSize;
+			# ifdef YUNI_OS_WINDOWS
+			void* pFileHandle;
+			void* pMappingHandle;
+			# endif
+			friend class MatrixCache;
+
+		}; // class Mapping
+
+
+	public:
+		/*!
+		** \brief Set the folder where the cache files are stored (empty to disable the cache)
+		*/
+		static void Folder(const AnyString& folder);
+
+		//! Get if the cache is enabled
+		static bool Enabled();
+
+		/*!
+		** \brief Signature of the types of a matrix (see Matrix<T,ReadWriteT>)
+		*/
+		static uint TypeSignature(uint typeSize, bool decimal, uint readWriteTypeSize, bool readWriteDecimal);
+
+		/*!
+		** \brief Map the cache file related to a CSV file
+		**
+		** \param out The mapping
+		** \param source The CSV file
+		** \param signature Signature of the types (see TypeSignature())
+		** \param typeSize Size of a single value
+		** \param minWidth The minimal width given to the CSV loading
+		** \param maxHeight The height given to the CSV loading
+		** \param fixedSize The fixed size flag given to the CSV loading
+		** \return True if the cache file exists and is up to date
+		*/
+		static bool Open(Mapping& out, const AnyString& source, uint signature, uint typeSize,
+			uint minWidth, uint maxHeight, bool fixedSize);
+
+		/*!
+		** \brief Prepare the content of a cache file (header only)
+		**
+		** The columns should be appended to the buffer (`height` values each),
+		** before calling Save().
+		*/
+		static void WriteHeader(Yuni::Clob& out, const AnyString& source, uint signature,
+			uint minWidth, uint maxHeight, bool fixedSize, uint width, uint height);
+
+		/*!
+		** \brief Write the content of a cache file into the cache folder
+		*/
+		static bool Save(const AnyString& source, const Yuni::Clob& content);
+
+	private:
+		//! Get the filename of the cache file for a given CSV file
+		static void CacheFilename(YString& out, const AnyString& source);
+
+	private:
+		//! Cache folder
+		static YString pFolder;
+
+	}; // class MatrixCache
+
+
+
+
+
+} // namespace Antares
+
+#endif // __ANTARES_LIBS_ARRAY_MATRIX_CACHE_H__
@@ -36,6 +36,7 @@
 # include "../memory/memory.h"
 # include "../study/fwd.h"
 # include "autoflush.h"
+# include "matrix-cache.h"
 
 
 
@@ -453,6 +454,21 @@ namespace Antares
 			uint minWidth, uint maxHeight, uint options,
 			BufferType* buffer = NULL);
 
+		/*!
+		** \brief Load data from the binary cache of a CSV file (see MatrixCache)
+		**
+		** \return True if the cache was up to date and the matrix loaded
+		*/
+		bool internalLoadFromCache(const AnyString& filename,
+			uint minWidth, uint maxHeight, uint options);
+
+		//! Write the binary cache of a CSV file freshly loaded (see MatrixCache)
+		void internalSaveToCache(const AnyString& filename,
+			uint minWidth, uint maxHeight, uint options) const;
+
+		//! Signature of the types of the matrix, for the binary cache
+		static uint cacheSignature();
+
 		//! Initialize the JIT structures and returns true
 		bool internalLoadJITData(const AnyString& filename,
 			uint minWidth, uint maxHeight, uint options);
@@ -30,17 +30,13 @@
 # include <yuni/yuni.h>
 # include <yuni/core/string.h>
 # include <yuni/core/math.h>
+# include <yuni/core/static/types.h>
 # include "../logs.h"
 # include "../string-to-double.h"
+# include "../double-to-string.h"
 # include "../io/statistics.h"
 
 
-# ifdef YUNI_OS_MSVC
-#	define ANTARES_MATRIX_SNPRINTF  sprintf_s
-# else
-#	define ANTARES_MATRIX_SNPRINTF  snprintf
-# endif
-
 # define ANTARES_MATRIX_CSV_COMMA      "\t;,"
 # define ANTARES_MATRIX_CSV_SEPARATORS "\t\r\n;,"
 
@@ -1063,6 +1059,74 @@ namespace Antares
 
 
 
+	template<class T, class ReadWriteT>
+	inline uint Matrix<T,ReadWriteT>::cacheSignature()
+	{
+		return MatrixCache::TypeSignature(sizeof(T), Yuni::Static::Type::IsDecimal<T>::Yes,
+			sizeof(ReadWriteT), Yuni::Static::Type::IsDecimal<ReadWriteT>::Yes);
+	}
+
+
+	template<class T, class ReadWriteT>
+	bool Matrix<T,ReadWriteT>::internalLoadFromCache(const AnyString& filename,
+		uint minWidth, uint maxHeight, uint options)
+	{
+		MatrixCache::Mapping mapping;
+		if (not MatrixCache::Open(mapping, filename, cacheSignature(), sizeof(T),
+			minWidth, maxHeight, (0 != (options & optFixedSize))))
+			return false;
+
+		# ifndef NDEBUG
+		logs.debug() << "  :: loading `" << filename << "' (cache)";
+		# endif
+
+		resize(mapping.width, mapping.height);
+		MatrixAutoFlush<MatrixType> autoflush(*this);
+		for (uint x = 0; x != width; ++x)
+		{
+			++autoflush;
+			ColumnType& column = entry[x];
+			const T* src = reinterpret_cast<const T*>(mapping.column(x));
+			# ifdef ANTARES_SWAP_SUPPORT
+			for (uint y = 0; y != height; ++y)
+				column[y] = src[y];
+			# else
+			(void)::memcpy((void*)column, src, sizeof(T) * height);
+			# endif
+		}
+		return true;
+	}
+
+
+	template<class T, class ReadWriteT>
+	void Matrix<T,ReadWriteT>::internalSaveToCache(const AnyString& filename,
+		uint minWidth, uint maxHeight, uint options) const
+	{
+		if (not width or not height)
+			return;
+
+		Yuni::Clob content;
+		MatrixCache::WriteHeader(content, filename, cacheSignature(),
+			minWidth, maxHeight, (0 != (options & optFixedSize)), width, height);
+		content.reserve(content.size() + (uint) (sizeof(T) * width * height));
+		for (uint x = 0; x != width; ++x)
+		{
+			const ColumnType& column = entry[x];
+			# ifdef ANTARES_SWAP_SUPPORT
+			for (uint y = 0; y != height; ++y)
+			{
+				const T value = column[y];
+				content.append(reinterpret_cast<const char*>(&value), (uint) sizeof(T));
+			}
+			# else
+			content.append(reinterpret_cast<const char*>((const T*) column), (uint) (sizeof(T) * height));
+			# endif
+		}
+		if (not MatrixCache::Save(filename, content))
+			logs.warning() << "impossible to write the cache file for '" << filename << "'";
+	}
+
+
 	template<class T, class ReadWriteT>
 	bool Matrix<T,ReadWriteT>::internalLoadCSVFile(const AnyString& filename,
 		uint minWidth, uint maxHeight, uint options, BufferType* buffer)
@@ -1072,14 +1136,30 @@ namespace Antares
 		// Status
 		bool result = false;
 
-		const bool hasOwnership = (NULL == buffer);
-		if (not buffer)
+		// Binary cache, when enabled
+		if (MatrixCache::Enabled() and internalLoadFromCache(filename, minWidth, maxHeight, options))
+		{
+			if (0 != (options & optMarkAsModified))
+			{
+				if (jit)
+					jit->markAsModified();
+			}
+			result = true;
+			buffer = nullptr;
+		}
+
+		const bool hasOwnership = (not result and NULL == buffer);
+		if (not result and not buffer)
 			buffer = new BufferType();
 
-		switch (IO::File::LoadFromFile(*buffer, filename, filesizeHardLimit))
+		switch (result ? IO::errNone : IO::File::LoadFromFile(*buffer, filename, filesizeHardLimit))
 		{
 			case IO::errNone:
 				{
+					// Already loaded from the cache
+					if (not buffer)
+						break;
+
 					// Empty files
 					if (buffer->empty())
 					{
@@ -1099,6 +1179,8 @@ namespace Antares
 					// Load the data
 					result = loadFromBuffer(filename, *buffer, minWidth, maxHeight,
 						(options & optFixedSize), options);
+					if (result and MatrixCache::Enabled())
+						internalSaveToCache(filename, minWidth, maxHeight, options);
 
 					// Mark as modified
 					if (0 != (options & optMarkAsModified))
@@ -1184,7 +1266,7 @@ namespace Antares
 					file.append(v);
 			}
 
-			static inline void Append(Yuni::Clob& file, T v, const char* const)
+			static inline void Append(Yuni::Clob& file, T v, uint)
 			{
 				Append(file, v);
 			}
@@ -1203,7 +1285,7 @@ namespace Antares
 				else
 				{
 					char ConversionBuffer[128];
-					const int sizePrintf = ANTARES_MATRIX_SNPRINTF(ConversionBuffer, sizeof(ConversionBuffer), "%.0f", v);
+					const int sizePrintf = Antares::DoubleToFixedString(ConversionBuffer, sizeof(ConversionBuffer), v, 0);
 
 					if (sizePrintf >= 0 and sizePrintf < (int)(sizeof(ConversionBuffer)))
 						file.write((const char*) ConversionBuffer, sizePrintf);
@@ -1212,7 +1294,7 @@ namespace Antares
 				}
 			}
 
-			static void Append(Yuni::Clob& file, double v, const char* const format)
+			static void Append(Yuni::Clob& file, double v, uint precision)
 			{
 				if (Yuni::Math::Zero(v))
 				{
@@ -1221,10 +1303,8 @@ namespace Antares
 				else
 				{
 					char ConversionBuffer[128];
-					const int sizePrintf =
-						(Yuni::Math::Zero(v - floor(v)))
-						? ANTARES_MATRIX_SNPRINTF(ConversionBuffer, sizeof(ConversionBuffer), "%.0f", v)
-						: ANTARES_MATRIX_SNPRINTF(ConversionBuffer, sizeof(ConversionBuffer), format, v);
+					const int sizePrintf = Antares::DoubleToFixedString(ConversionBuffer, sizeof(ConversionBuffer),
+						v, (Yuni::Math::Zero(v - floor(v))) ? 0 : precision);
 
 					if (sizePrintf >= 0 and sizePrintf < (int)(sizeof(ConversionBuffer)))
 						file.write((const char*) ConversionBuffer, sizePrintf);
@@ -1247,7 +1327,7 @@ namespace Antares
 				else
 				{
 					char ConversionBuffer[128];
-					const int sizePrintf = ANTARES_MATRIX_SNPRINTF(ConversionBuffer, sizeof(ConversionBuffer), "%.0f", (double)v);
+					const int sizePrintf = Antares::DoubleToFixedString(ConversionBuffer, sizeof(ConversionBuffer), (double)v, 0);
 
 					if (sizePrintf >= 0 and sizePrintf < (int)(sizeof(ConversionBuffer)))
 						file.write((const char*) ConversionBuffer, sizePrintf);
@@ -1256,7 +1336,7 @@ namespace Antares
 				}
 			}
 
-			static void Append(Yuni::Clob& file, float v, const char* const format)
+			static void Append(Yuni::Clob& file, float v, uint precision)
 			{
 				if (Yuni::Math::Zero(v))
 				{
@@ -1265,10 +1345,8 @@ namespace Antares
 				else
 				{
 					char ConversionBuffer[128];
-					const int sizePrintf =
-						(Yuni::Math::Zero(v - floor(v)))
-						? ANTARES_MATRIX_SNPRINTF(ConversionBuffer, sizeof(ConversionBuffer), "%.0f", (double)v)
-						: ANTARES_MATRIX_SNPRINTF(ConversionBuffer, sizeof(ConversionBuffer), format, (double)v);
+					const int sizePrintf = Antares::DoubleToFixedString(ConversionBuffer, sizeof(ConversionBuffer),
+						(double)v, (Yuni::Math::Zero(v - floor(v))) ? 0 : precision);
 
 					if (sizePrintf >= 0 and sizePrintf < (int)(sizeof(ConversionBuffer)))
 						file.write((const char*) ConversionBuffer, sizePrintf);
@@ -1344,19 +1422,8 @@ namespace Antares
 			// Does nothing if the matrix only contains zero
 			return;
 
-		// Determining the string format to use according the given precision
-		const char* format = nullptr;
-		if (isDecimal and precision)
-		{
-			static const char* const sfmt[] =
-			{
-				"%.0f",  "%.1f",  "%.2f", "%.3f",  "%.4f",  "%.5f",  "%.6f",
-				"%.7f",	 "%.8f",  "%.9f", "%.10f", "%.11f", "%.12f", "%.13f",
-				"%.14f", "%.15f", "%.16f",
-			};
-			assert(precision <= 16);
-			format = sfmt[precision];
-		}
+		// The number of decimals is directly given to the conversion routine
+		assert(precision <= 16);
 
 		// pre-allocate, should be enough in nearly all cases
 		// data.clear(), the buffer is already empty
@@ -1380,7 +1447,7 @@ namespace Antares
 			{
 				for (uint y = 0; y != height; ++y)
 				{
-					MatrixScalar<ReadWriteT>::Append(data, (ReadWriteT) predicate(entry[0][y]), format);
+					MatrixScalar<ReadWriteT>::Append(data, (ReadWriteT) predicate(entry[0][y]), precision);
 					data += '\n';
 				}
 			}
@@ -1404,11 +1471,11 @@ namespace Antares
 			{
 				for (uint y = 0; y != height; ++y)
 				{
-					MatrixScalar<ReadWriteT>::Append(data, (ReadWriteT) predicate(entry[0][y]), format);
+					MatrixScalar<ReadWriteT>::Append(data, (ReadWriteT) predicate(entry[0][y]), precision);
 					for (uint x = 1; x < width; ++x)
 					{
 						data += '\t';
-						MatrixScalar<ReadWriteT>::Append(data, (ReadWriteT) predicate(entry[x][y]), format);
+						MatrixScalar<ReadWriteT>::Append(data, (ReadWriteT) predicate(entry[x][y]), precision);
 					}
 					data += '\n';
 				}
@@ -2018,6 +2085,4 @@ namespace Antares
 
 } // namespace Antares
 
-# undef ANTARES_MATRIX_SNPRINTF
-
 #endif // __ANTARES_LIBS_ARRAY_MATRIX_HXX__
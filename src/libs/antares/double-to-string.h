@@ -0,0 +1,115 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#ifndef __ANTARES_LIBS_DOUBLE_TO_STRING_H__
+# define __ANTARES_LIBS_DOUBLE_TO_STRING_H__
+
+# include <cmath>
+# include <cstdio>
+
+
+
+namespace Antares
+{
+
+	/*!
+	** \brief Convert a double into a C-String with a fixed number of decimals
+	**
+	** The result is strictly the same than `snprintf(buffer, size, "%.<decimals>f", v)`,
+	** without the parsing of the format string nor the locale handling. The printf
+	** routine is only used as a fallback for the values which can not be handled
+	** exactly (huge values, NaN/Inf, or when the scaled value is too close to a tie).
+	**
+	** \param buffer The output buffer (at least 32 bytes are recommended)
+	** \param size Size of the output buffer
+	** \param v The value to convert
+	** \param decimals The number of decimals (<= 16)
+	** \return The number of chars written (excluding the final zero), like snprintf
+	*/
+	inline int DoubleToFixedString(char* buffer, unsigned int size, double v, unsigned int decimals)
+	{
+		static const double powersOf10[] =
+		{
+			1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8,
+			1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16,
+		};
+
+		if (decimals <= 16 and size >= 40)
+		{
+			// The product is exact up to half an ulp. Below 2^52 the integer part is
+			// exact as well, so only the ties require the exact decimal expansion of v
+			const double scaled = std::fabs(v * powersOf10[decimals]);
+			if (scaled < 4.5e15)
+			{
+				const double integral = std::floor(scaled);
+				const double fraction = scaled - integral;
+				if (std::fabs(fraction - 0.5) > scaled * 4.5e-16)
+				{
+					unsigned long long n = static_cast<unsigned long long>(integral);
+					if (fraction > 0.5)
+						++n;
+
+					// digits, from the end
+					char tmp[40];
+					unsigned int len = 0;
+					for (unsigned int i = 0; i != decimals; ++i)
+					{
+						tmp[len++] = static_cast<char>('0' + (n % 10));
+						n /= 10;
+					}
+					if (decimals)
+						tmp[len++] = '.';
+					do
+					{
+						tmp[len++] = static_cast<char>('0' + (n % 10));
+						n /= 10;
+					}
+					while (n);
+
+					unsigned int written = 0;
+					if (std::signbit(v))
+						buffer[written++] = '-';
+					while (len)
+						buffer[written++] = tmp[--len];
+					buffer[written] = '\0';
+					return static_cast<int>(written);
+				}
+			}
+		}
+
+		// Fallback
+		# ifdef YUNI_OS_MSVC
+		return ::sprintf_s(buffer, size, "%.*f", static_cast<int>(decimals), v);
+		# else
+		return ::snprintf(buffer, size, "%.*f", static_cast<int>(decimals), v);
+		# endif
+	}
+
+
+
+} // namespace Antares
+
+#endif // __ANTARES_LIBS_DOUBLE_TO_STRING_H__
@@ -0,0 +1,252 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+
+#include "binary-results.h"
+#include <yuni/io/file.h>
+#include "statistics.h"
+#include "../logs/logs.h"
+
+using namespace Yuni;
+
+
+namespace Antares
+{
+namespace BinaryResults
+{
+
+	static const char magic[8] = { 'A', 'N', 'T', 'R', 'B', 'I', 'N', '\0' };
+
+
+
+
+	Writer::Writer(Clob& buffer) :
+		pBuffer(buffer),
+		pColumnCountOffset(0),
+		pColumnCount(0),
+		pRowBegin(0),
+		pRowCount(0)
+	{
+		pBuffer.clear();
+	}
+
+
+	void Writer::writeString(const AnyString& text)
+	{
+		write<uint32>((uint32) text.size());
+		pBuffer.append(text.c_str(), text.size());
+	}
+
+
+	void Writer::begin(int dataLevel, int fileLevel, int precisionLevel, uint rowBegin, uint rowCount,
+		const AnyString& name)
+	{
+		pBuffer.clear();
+		pBuffer.append(magic, (uint) sizeof(magic));
+		write<uint32>((uint32) version);
+		write<sint32>((sint32) dataLevel);
+		write<sint32>((sint32) fileLevel);
+		write<sint32>((sint32) precisionLevel);
+		write<uint32>((uint32) rowBegin);
+		write<uint32>((uint32) rowCount);
+
+		pColumnCount = 0;
+		pColumnCountOffset = pBuffer.size();
+		write<uint32>((uint32) 0);
+		writeString(name);
+
+		pRowBegin = rowBegin;
+		pRowCount = rowCount;
+	}
+
+
+
+
+
+
+	namespace // anonymous
+	{
+
+		//! Sequential reading of a buffer, with bound checking
+		class BufferReader final
+		{
+		public:
+			explicit BufferReader(const Clob& buffer) :
+				pData(buffer.c_str()),
+				pSize(buffer.size()),
+				pOffset(0)
+			{}
+
+			template<class U> bool read(U& out)
+			{
+				if (pOffset + sizeof(U) > pSize)
+					return false;
+				memcpy(&out, pData + pOffset, sizeof(U));
+				pOffset += (uint) sizeof(U);
+				return true;
+			}
+
+			bool readString(String& out)
+			{
+				uint32 length;
+				// pOffset + length could wrap with a corrupt length
+				if (not read(length) or pOffset > pSize or length > pSize - pOffset)
+					return false;
+				out.assign(pData + pOffset, length);
+				pOffset += length;
+				return true;
+			}
+
+			template<class U> bool readValues(std::vector<double>& out, uint count)
+			{
+				if (pOffset + (uint64) count * sizeof(U) > pSize)
+					return false;
+				out.resize(count);
+				U value;
+				for (uint y = 0; y != count; ++y)
+				{
+					memcpy(&value, pData + pOffset, sizeof(U));
+					out[y] = (double) value;
+					pOffset += (uint) sizeof(U);
+				}
+				return true;
+			}
+
+			//! Number of bytes not read yet
+			uint remaining() const
+			{
+				return (pOffset < pSize) ? pSize - pOffset : 0;
+			}
+
+		private:
+			const char* pData;
+			uint pSize;
+			uint pOffset;
+		};
+
+	} // anonymous namespace
+
+
+
+	Reader::Reader() :
+		dataLevel(0),
+		fileLevel(0),
+		precisionLevel(0),
+		rowBegin(0),
+		rowCount(0)
+	{}
+
+
+	bool Reader::loadFromFile(const AnyString& filename)
+	{
+		columns.clear();
+		name.clear();
+		rowBegin = 0;
+		rowCount = 0;
+
+		Clob buffer;
+		if (IO::errNone != IO::File::LoadFromFile(buffer, filename))
+			return false;
+		Statistics::HasReadFromDisk(buffer.size());
+
+		BufferReader in(buffer);
+		char header[sizeof(magic)];
+		if (not in.read(header) or 0 != memcmp(header, magic, sizeof(magic)))
+		{
+			logs.error() << filename << ": invalid binary results file";
+			return false;
+		}
+
+		uint32 fileVersion;
+		sint32 levels[3];
+		uint32 columnCount;
+		if (not in.read(fileVersion) or not in.read(levels) or not in.read(rowBegin)
+			or not in.read(rowCount) or not in.read(columnCount) or not in.readString(name))
+		{
+			logs.error() << filename << ": invalid header";
+			return false;
+		}
+		if (fileVersion != (uint32) version)
+		{
+			logs.error() << filename << ": unsupported version " << fileVersion;
+			return false;
+		}
+		// Checked before allocating anything : each column takes at least
+		// its captions lengths, its decimals and its encoding
+		if (rowBegin > (uint) maxRowCount or rowCount > (uint) maxRowCount - rowBegin
+			or columnCount > in.remaining() / (captionCount * sizeof(uint32) + 2))
+		{
+			logs.error() << filename << ": invalid header";
+			return false;
+		}
+		dataLevel      = levels[0];
+		fileLevel      = levels[1];
+		precisionLevel = levels[2];
+
+		columns.resize(columnCount);
+		for (uint x = 0; x != columnCount; ++x)
+		{
+			auto& column = columns[x];
+			bool good = true;
+			for (uint i = 0; i != captionCount; ++i)
+				good = good and in.readString(column.captions[i]);
+
+			uint8 decimals;
+			uint8 encoding;
+			good = good and in.read(decimals) and in.read(encoding);
+			if (good)
+			{
+				column.decimals = decimals;
+				switch (encoding)
+				{
+					case encZero:
+						column.values.assign(rowCount, 0.);
+						break;
+					case encFloat64:
+						good = in.readValues<double>(column.values, rowCount);
+						break;
+					case encFloat32:
+						good = in.readValues<float>(column.values, rowCount);
+						break;
+					default:
+						good = false;
+				}
+			}
+			if (not good)
+			{
+				logs.error() << filename << ": invalid data for the column " << (x + 1);
+				columns.clear();
+				return false;
+			}
+		}
+		return true;
+	}
+
+
+
+
+} // namespace BinaryResults
+} // namespace Antares
@@ -0,0 +1,177 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#ifndef __LIBS_ANTARES_IO_BINARY_RESULTS_H__
+# define __LIBS_ANTARES_IO_BINARY_RESULTS_H__
+
+# include <yuni/yuni.h>
+# include <yuni/core/string.h>
+# include <vector>
+# include <cstring>
+
+
+
+namespace Antares
+{
+namespace BinaryResults
+{
+
+	/*!
+	** \brief Binary columnar format for the simulation results (.bin)
+	**
+	** It is an alternative to the tab-separated survey files (same folder, same
+	** name, `.bin` extension), which can be read without any text parsing.
+	** All numbers are stored in the native byte order (little-endian on all
+	** supported platforms) :
+	**
+	** - magic `ANTRBIN` + '\0' (8 bytes), version (uint32)
+	** - data level, file level, precision level (int32, see Solver::Variable::Category)
+	** - first row (zero-based), row count, column count (uint32)
+	** - the name of the item (area, link...) (uint32 length + chars)
+	** - for each column :
+	**    - 3 captions (uint32 length + chars)
+	**    - the number of decimals used in the text format (uint8)
+	**    - the encoding of the values (uint8, see Encoding)
+	**    - `row count` values according to the encoding
+	*/
+	enum Encoding
+	{
+		//! All values are null, nothing is stored
+		encZero = 0,
+		//! Double precision
+		encFloat64 = 1,
+		//! Single precision (only used when lossless)
+		encFloat32 = 2,
+	};
+
+	enum
+	{
+		//! Current version of the format
+		version = 1,
+		//! Number of captions for each column
+		captionCount = 3,
+		//! Maximum number of rows (the hours of a leap year)
+		maxRowCount = 8784,
+	};
+
+
+
+	/*!
+	** \brief Serialize results in the binary columnar format
+	**
+	** \code
+	** Writer writer(buffer);
+	** writer.begin(dataLevel, fileLevel, precisionLevel, rowBegin, rowCount, "fr");
+	** writer.addColumn("LOAD", "MWh", "EXP", 2, values);
+	** IOFileSetContent(filename, buffer);
+	** \endcode
+	*/
+	class Writer final
+	{
+	public:
+		//! Constructor, with the buffer where to write (it will be cleared)
+		explicit Writer(Yuni::Clob& buffer);
+
+		//! Write the header
+		void begin(int dataLevel, int fileLevel, int precisionLevel, uint rowBegin, uint rowCount,
+			const AnyString& name);
+
+		/*!
+		** \brief Append a column
+		**
+		** \param name The name of the variable (first caption)
+		** \param unit The unit (second caption)
+		** \param stat The statistic (third caption: EXP, std, min...)
+		** \param decimals The number of decimals used in the text format
+		** \param values Any indexed container, values[rowBegin .. rowBegin + rowCount[ are written
+		*/
+		template<class ColumnT>
+		void addColumn(const AnyString& name, const AnyString& unit, const AnyString& stat,
+			uint decimals, const ColumnT& values);
+
+	private:
+		void writeString(const AnyString& text);
+		template<class U> void write(const U& value);
+
+	private:
+		Yuni::Clob& pBuffer;
+		//! Offset of the column count into the buffer
+		uint pColumnCountOffset;
+		uint pColumnCount;
+		uint pRowBegin;
+		uint pRowCount;
+
+	}; // class Writer
+
+
+
+	/*!
+	** \brief Load results written in the binary columnar format
+	*/
+	class Reader final
+	{
+	public:
+		struct Column
+		{
+			//! Captions
+			Yuni::String captions[captionCount];
+			//! Number of decimals for the text format
+			uint decimals;
+			//! All values
+			std::vector<double> values;
+		};
+
+	public:
+		//! Default constructor
+		Reader();
+
+		//! Load a .bin file
+		bool loadFromFile(const AnyString& filename);
+
+	public:
+		int dataLevel;
+		int fileLevel;
+		int precisionLevel;
+		//! First row (zero-based)
+		uint rowBegin;
+		//! Number of rows
+		uint rowCount;
+		//! Name of the item
+		Yuni::String name;
+		//! All columns
+		std::vector<Column> columns;
+
+	}; // class Reader
+
+
+
+
+} // namespace BinaryResults
+} // namespace Antares
+
+# include "binary-results.hxx"
+
+#endif // __LIBS_ANTARES_IO_BINARY_RESULTS_H__
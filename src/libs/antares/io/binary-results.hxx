@@ -0,0 +1,100 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#ifndef __LIBS_ANTARES_IO_BINARY_RESULTS_HXX__
+# define __LIBS_ANTARES_IO_BINARY_RESULTS_HXX__
+
+
+namespace Antares
+{
+namespace BinaryResults
+{
+
+	template<class U>
+	inline void Writer::write(const U& value)
+	{
+		pBuffer.append(reinterpret_cast<const char*>(&value), (uint) sizeof(U));
+	}
+
+
+	template<class ColumnT>
+	void Writer::addColumn(const AnyString& name, const AnyString& unit, const AnyString& stat,
+		uint decimals, const ColumnT& values)
+	{
+		writeString(name);
+		writeString(unit);
+		writeString(stat);
+		write<Yuni::uint8>((Yuni::uint8) decimals);
+
+		const uint end = pRowBegin + pRowCount;
+
+		// The most compact lossless encoding
+		Encoding encoding = encZero;
+		for (uint y = pRowBegin; y != end; ++y)
+		{
+			const double v = values[y];
+			if (v != 0.)
+			{
+				if ((double)((float) v) != v)
+				{
+					encoding = encFloat64;
+					break;
+				}
+				encoding = encFloat32;
+			}
+		}
+		write<Yuni::uint8>((Yuni::uint8) encoding);
+
+		switch (encoding)
+		{
+			case encFloat64:
+				{
+					for (uint y = pRowBegin; y != end; ++y)
+						write<double>(values[y]);
+					break;
+				}
+			case encFloat32:
+				{
+					for (uint y = pRowBegin; y != end; ++y)
+						write<float>((float) values[y]);
+					break;
+				}
+			case encZero:
+				break;
+		}
+
+		// Updating the column count in the header
+		++pColumnCount;
+		memcpy(pBuffer.data() + pColumnCountOffset, &pColumnCount, sizeof(uint));
+	}
+
+
+
+
+} // namespace BinaryResults
+} // namespace Antares
+
+#endif // __LIBS_ANTARES_IO_BINARY_RESULTS_HXX__
@@ -49,7 +49,7 @@
 #include "../study/memory-usage.h"
 #include "swapfile.h"
 #include "../sys/policy.h"
-#include <unordered_map>
+#include <atomic>
 
 using namespace Yuni;
 
@@ -74,27 +74,150 @@ namespace Antares
 		typedef Antares::Private::Memory::SwapFileInfo  SwapFileInfo;
 		//! Informations about a list of swap files
 		typedef std::vector<SwapFileInfo*> SwapFileList;
-		//! handle mapping
-		typedef std::unordered_map<Memory::Handle, Memory::Mapping*> MappingMap;
+
+		enum
+		{
+			//! Number of handles per page of the handle table
+			mappingPageSize = 4096,
+			//! Maximum number of pages of the handle table
+			mappingPageCount = 16384,
+			//! Number of locks for mapping / unmapping the blocks (a handle always uses the same one)
+			mappingLockCount = 64,
+		};
+
+		//! A page of the handle table
+		typedef std::atomic<Memory::Mapping*> MappingPage[mappingPageSize];
+
+		//! The swap region of a thread, and the handles it has currently mapped
+		struct Region
+		{
+			Yuni::Mutex mutex;
+			std::vector<Memory::Handle> mapped;
+		};
 
 		// Global mutex for memory handler
+		// It protects the swap files and the allocation / release of the handles.
+		// Mapping, unmapping or looking up a handle does not require it.
 		static Yuni::Mutex gMutex;
 
 		//! The next handle which should be used
 		static Memory::Handle pNextHandle = 0; // It will be incremented by internalAllocate()
-		//! Mapping handle
-		static MappingMap pMapping;
+		//! Released handles, which can be used again
+		static std::vector<Memory::Handle> pFreeHandles;
+		//! Handle table (handle -> mapping), read without any lock
+		static std::atomic<MappingPage*> pMappingPages[mappingPageCount];
+		//! Locks for mapping / unmapping
+		static Yuni::Mutex gMappingLocks[mappingLockCount];
+		//! All swap regions
+		static Region pRegions[Memory::regionCount];
+		//! The swap region of the calling thread
+		static thread_local uint pCurrentRegion = 0;
 		//! All swap files
 		static SwapFileList pSwapFile;
 
 
 
+		static inline Yuni::Mutex& MappingLock(Memory::Handle handle)
+		{
+			return gMappingLocks[handle % mappingLockCount];
+		}
+
+
+		static inline Memory::Mapping* FindMapping(Memory::Handle handle)
+		{
+			if (handle / mappingPageSize >= mappingPageCount)
+				return nullptr;
+			MappingPage* page = pMappingPages[handle / mappingPageSize].load(std::memory_order_acquire);
+			return (page) ? (*page)[handle % mappingPageSize].load(std::memory_order_acquire) : nullptr;
+		}
+
+
+		static void RegisterMappingWL(Memory::Handle handle, Memory::Mapping* mapping)
+		{
+			auto& slot = pMappingPages[handle / mappingPageSize];
+			MappingPage* page = slot.load(std::memory_order_relaxed);
+			if (not page)
+			{
+				page = new MappingPage[1];
+				for (uint i = 0; i != (uint) mappingPageSize; ++i)
+					(*page)[i].store(nullptr, std::memory_order_relaxed);
+				slot.store(page, std::memory_order_release);
+			}
+			(*page)[handle % mappingPageSize].store(mapping, std::memory_order_release);
+		}
+
+
+		static Memory::Handle NewHandleWL()
+		{
+			if (not pFreeHandles.empty())
+			{
+				Memory::Handle handle = pFreeHandles.back();
+				pFreeHandles.pop_back();
+				return handle;
+			}
+			if ((pNextHandle + 1) / mappingPageSize >= mappingPageCount)
+				return Memory::invalidHandle;
+			return ++pNextHandle;
+		}
+
+
+		static inline void RemoveFromRegion(Memory::Handle handle, Memory::Mapping& mapping)
+		{
+			Region& region = pRegions[mapping.region];
+			Yuni::MutexLocker locker(region.mutex);
+			auto& mapped = region.mapped;
+			assert(mapping.mappedIndex < mapped.size() and mapped[mapping.mappedIndex] == handle);
+
+			Memory::Handle last = mapped.back();
+			if (last != handle)
+			{
+				mapped[mapping.mappedIndex] = last;
+				FindMapping(last)->mappedIndex = mapping.mappedIndex;
+			}
+			mapped.pop_back();
+		}
+
+
+		// The lock of the handle must be held
+		static inline void AddMappingWL(Memory::Handle handle, Memory::Mapping& mapping,
+			volatile void* pointer, void* p)
+		{
+			*((volatile void**) pointer) = p;
+			mapping.pointer = (volatile void**) pointer;
+			mapping.region  = pCurrentRegion;
+
+			Region& region = pRegions[pCurrentRegion];
+			Yuni::MutexLocker locker(region.mutex);
+			mapping.mappedIndex = (uint) region.mapped.size();
+			region.mapped.push_back(handle);
+		}
+
 
-		static inline void FlushMappingWL(Memory::Mapping& mapping)
+		// The lock of the handle must be held
+		// A block used by several regions is given to the region 0 : it must not be
+		// unmapped by the flushRegion() of one of them while the others still use it.
+		// It is unmapped by flushAll(), or by flushing the block itself.
+		static inline void ShareMappingWL(Memory::Handle handle, Memory::Mapping& mapping)
+		{
+			if (mapping.region == pCurrentRegion or mapping.region == 0)
+				return;
+			RemoveFromRegion(handle, mapping);
+			mapping.region = 0;
+
+			Region& region = pRegions[0];
+			Yuni::MutexLocker locker(region.mutex);
+			mapping.mappedIndex = (uint) region.mapped.size();
+			region.mapped.push_back(handle);
+		}
+
+
+		// The lock of the handle must be held
+		static inline void FlushMappingWL(Memory::Handle handle, Memory::Mapping& mapping)
 		{
 			void** p = const_cast<void**>(mapping.pointer);
 			if (p)
 			{
+				RemoveFromRegion(handle, mapping);
 				if (*p)
 				{
 					// Unmapping
@@ -110,6 +233,29 @@ namespace Antares
 		}
 
 
+		static void FlushRegion(uint index)
+		{
+			Region& region = pRegions[index];
+			std::vector<Memory::Handle> handles;
+			{
+				Yuni::MutexLocker locker(region.mutex);
+				if (region.mapped.empty())
+					return;
+				handles = region.mapped;
+			}
+
+			for (uint i = 0; i != (uint) handles.size(); ++i)
+			{
+				Yuni::MutexLocker locker(MappingLock(handles[i]));
+				// The handle may have been flushed, released or mapped again by another
+				// region in the meantime
+				Memory::Mapping* mapping = FindMapping(handles[i]);
+				if (mapping and mapping->pointer and mapping->region == index)
+					FlushMappingWL(handles[i], *mapping);
+			}
+		}
+
+
 	} // anonymous namespace
 
 
@@ -135,6 +281,9 @@ namespace Antares
 			for (uint i = 0; i != pSwapFile.size(); ++i)
 				delete pSwapFile[i];
 		}
+		// Destroying the handle table
+		for (uint i = 0; i != (uint) mappingPageCount; ++i)
+			delete[] pMappingPages[i].exchange(nullptr);
 	}
 
 
@@ -209,11 +358,8 @@ namespace Antares
 		if (not pSwapFile.empty())
 		{
 			// Flush all handle first
-			{
-				const MappingMap::iterator end = pMapping.end();
-				for (MappingMap::iterator i = pMapping.begin(); i != end; ++i)
-					FlushMappingWL(*(i->second));
-			}
+			for (uint i = 0; i != (uint) regionCount; ++i)
+				FlushRegion(i);
 
 			bool stop = true;
 			do
@@ -304,20 +450,23 @@ namespace Antares
 			result += sizeof(SwapFileInfo) + swap.filename.capacity() + swap.blocks.size();
 		}
 
-		// mapping overhead
-		// (sizeof(A) + sizeof(B) + ELEMENT_OVERHEAD) * N + CONTAINER_OVERHEAD
-		enum
+		// handle table overhead
+		for (uint i = 0; i != (uint) mappingPageCount; ++i)
 		{
-			mapOverheadPerElement = (sizeof(Handle) + sizeof(Mapping*) + sizeof(32/*std::_Rb_tree_node_base*/))
-		};
-		result += pMapping.size() * (sizeof(Mapping) + mapOverheadPerElement);
+			if (pMappingPages[i].load(std::memory_order_relaxed))
+				result += sizeof(MappingPage);
+		}
+		result += pFreeHandles.capacity() * sizeof(Handle);
 
-		const MappingMap::const_iterator end = pMapping.end();
-		for (MappingMap::const_iterator i = pMapping.begin(); i != end; ++i)
+		for (Handle handle = 1; handle <= pNextHandle; ++handle)
 		{
-			const Mapping& mapping = *(i->second);
-			if (mapping.pointer)
-				result += mapping.nbBlocks * blockSize;
+			const Mapping* mapping = FindMapping(handle);
+			if (mapping)
+			{
+				result += sizeof(Mapping);
+				if (mapping->pointer)
+					result += mapping->nbBlocks * blockSize;
+			}
 		}
 		return result;
 	}
@@ -354,6 +503,12 @@ namespace Antares
 
 		Yuni::MutexLocker locker(gMutex);
 		assert(pAlreadyInitialized and "swap memory not initialized");
+
+		// Looking for a valid handle
+		Handle handle = NewHandleWL();
+		if (handle == invalidHandle)
+			return invalidHandle;
+
 		do
 		{
 			// Browsing all available swap file to find an empty slot
@@ -398,15 +553,6 @@ namespace Antares
 				for (uint j = 0; j != blockNeeded; ++j)
 					bitmap.set(offset + j);
 
-				// Looking for a valid handle
-				{
-					const MappingMap::iterator end = pMapping.end();
-					while (pMapping.find(++pNextHandle) != end or not pNextHandle) // or (uint) -1 == pNextHandle)
-					{
-						// does nothing
-					}
-				}
-
 				// Less blocks are now available
 				swap.nbFreeBlocks -= blockNeeded;
 
@@ -416,17 +562,22 @@ namespace Antares
 				mapping->offset       = offset;
 				mapping->nbBlocks     = blockNeeded;
 				mapping->swapFile     = &swap;
-				pMapping[pNextHandle] = mapping;
-				// std::cout << "  allocate handle " << pNextHandle << " of " << blockNeeded << " blocks" << '\n';
+				mapping->region       = 0;
+				mapping->mappedIndex  = 0;
+				RegisterMappingWL(handle, mapping);
+				// std::cout << "  allocate handle " << handle << " of " << blockNeeded << " blocks" << '\n';
 
 				// Returning the current handle
-				return pNextHandle;
+				return handle;
 			}
 
 			// No free block remains. We have to allocate a new swap file
 			// and try again.
 			if (not createNewSwapFileWL())
+			{
+				pFreeHandles.push_back(handle);
 				return invalidHandle;
+			}
 		}
 		while (true);
 
@@ -439,17 +590,24 @@ namespace Antares
 		Yuni::MutexLocker locker(gMutex);
 
 		// higher pointers should be located into the last swap files
-		MappingMap::iterator end = pMapping.end();
-		for (MappingMap::iterator i = pMapping.begin(); i != end; ++i)
+		for (Handle handle = 1; handle <= pNextHandle; ++handle)
 		{
-			Mapping& mapping = *(i->second);
-			releaseWL(mapping);
-			delete i->second;
+			Mapping* mapping;
+			{
+				Yuni::MutexLocker mappingLocker(MappingLock(handle));
+				mapping = FindMapping(handle);
+				if (not mapping)
+					continue;
+				FlushMappingWL(handle, *mapping);
+				RegisterMappingWL(handle, nullptr);
+			}
+			releaseWL(*mapping);
+			delete mapping;
 		}
-		pMapping.clear();
 
 		// Reset the next handle
 		pNextHandle = 0;
+		pFreeHandles.clear();
 	}
 
 
@@ -460,21 +618,10 @@ namespace Antares
 		// Updating the new amount of free blocks
 		currentSwapFile.nbFreeBlocks += mapping.nbBlocks;
 
-		// unmapping the pointer
+		// The pointer must have been unmapped before (FlushMappingWL)
 		// On Windows, all pointers must be unmapped before closing the file
 		// descriptor
-		// This is not mandatory on Unixes but it will be better like that.
-		void** p = const_cast<void**>(mapping.pointer);
-		if (p and *p)
-		{
-			// Unmapping
-			# ifdef YUNI_OS_WINDOWS
-			UnmapViewOfFile(*p);
-			# else
-			munmap(*p, mapping.nbBlocks * blockSize);
-			# endif
-			*p = nullptr;
-		}
+		assert(mapping.pointer == nullptr);
 
 		// Checking if we should merely remove the swap file
 		if (currentSwapFile.nbFreeBlocks == blockPerSwap and pSwapFile.size() != 1)
@@ -522,12 +669,21 @@ namespace Antares
 		assert(handle != 0);
 		gMutex.lock();
 
-		MappingMap::iterator i = pMapping.find(handle);
-		if (i != pMapping.end())
+		Mapping* mapping;
+		{
+			Yuni::MutexLocker locker(MappingLock(handle));
+			mapping = FindMapping(handle);
+			if (mapping)
+			{
+				FlushMappingWL(handle, *mapping);
+				RegisterMappingWL(handle, nullptr);
+			}
+		}
+
+		if (mapping)
 		{
-			Mapping* mapping = i->second;
 			releaseWL(*mapping);
-			pMapping.erase(i);
+			pFreeHandles.push_back(handle);
 			gMutex.unlock();
 
 			delete mapping;
@@ -542,16 +698,25 @@ namespace Antares
 		assert(handle != 0);
 		assert(pointer != NULL);
 
-		// Locking
-		Yuni::MutexLocker locker(gMutex);
+		// Locking (only the handle, the global lock is not required)
+		Yuni::MutexLocker locker(MappingLock(handle));
 
-		MappingMap::iterator i = pMapping.find(handle);
-		if (i != pMapping.end())
+		Mapping* mapping = FindMapping(handle);
+		if (mapping)
 		{
-			Mapping& m = *(i->second);
-			m.pointer = (volatile void**) pointer;
+			Mapping& m = *mapping;
+			if (m.pointer)
+			{
+				// Already mapped by another thread, with the same pointer
+				if (m.pointer == (volatile void**) pointer and *m.pointer)
+				{
+					ShareMappingWL(handle, m);
+					return const_cast<void*>(*m.pointer);
+				}
+				FlushMappingWL(handle, m);
+			}
 
-			// Unmapping
+			// Mapping
 			# ifdef YUNI_OS_WINDOWS
 			// On Windows, for code safety, we have to use exceptions....
 			try
@@ -575,6 +740,7 @@ namespace Antares
 					}
 					return nullptr;
 				}
+				AddMappingWL(handle, m, pointer, p);
 				return p;
 			}
 			catch (...)
@@ -594,23 +760,15 @@ namespace Antares
 					<< m.swapFile->filename;
 				return nullptr;
 			}
+			// The whole block will be read soon : asking the kernel to read it ahead
+			// asynchronously instead of page faulting on each page
+			posix_madvise(p, m.nbBlocks * blockSize, POSIX_MADV_WILLNEED);
+			AddMappingWL(handle, m, pointer, p);
 			return p;
 			# endif
 		}
 
 		logs.error() << "memory pool: impossible to acquire the ressource " << handle << ": Resource ID not found";
-		# ifndef NDEBUG
-		{
-			logs.info() << "trace: ";
-			const MappingMap::iterator end = pMapping.end();
-			for (MappingMap::iterator i = pMapping.begin(); i != end; ++i)
-			{
-				logs.info() << "  id: " << i->first << ",  ptr: " << (void*) i->second->pointer
-					<< ",  offset: " << i->second->offset;
-			}
-		}
-		# endif
-
 		return nullptr;
 	}
 
@@ -620,23 +778,41 @@ namespace Antares
 	# ifdef ANTARES_SWAP_SUPPORT
 	void Memory::flushAll()
 	{
-		Yuni::MutexLocker locker(gMutex);
-		const MappingMap::iterator end = pMapping.end();
-		for (MappingMap::iterator i = pMapping.begin(); i != end; ++i)
-			FlushMappingWL(*(i->second));
+		for (uint i = 0; i != (uint) regionCount; ++i)
+			FlushRegion(i);
+	}
+
+
+	void Memory::flushRegion()
+	{
+		FlushRegion(pCurrentRegion);
 	}
 	# endif
 
 
+	void Memory::SelectRegion(uint region)
+	{
+		assert(region < (uint) regionCount && "invalid swap region");
+		if (region < (uint) regionCount)
+			pCurrentRegion = region;
+		else
+		{
+			// The blocks will only be unmapped by flushAll()
+			logs.warning() << "memory pool: invalid swap region " << region << ", the default one is used";
+			pCurrentRegion = 0;
+		}
+	}
+
+
 
 	void Memory::flush(Handle handle)
 	{
 		if (handle)
 		{
-			Yuni::MutexLocker locker(gMutex);
-			MappingMap::iterator i = pMapping.find(handle);
-			if (i != pMapping.end())
-				FlushMappingWL(*(i->second));
+			Yuni::MutexLocker locker(MappingLock(handle));
+			Mapping* mapping = FindMapping(handle);
+			if (mapping)
+				FlushMappingWL(handle, *mapping);
 		}
 	}
 
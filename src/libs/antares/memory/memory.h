@@ -98,6 +98,10 @@ namespace Antares
 			uint offset;
 			//! The number of block used by this data block
 			uint nbBlocks;
+			//! The region which has mapped the block (valid only if mapped)
+			uint region;
+			//! Index of the handle in the list of the mapped handles of the region
+			uint mappedIndex;
 		};
 
 
@@ -132,6 +136,14 @@ namespace Antares
 
 			//! Invalid handle
 			invalidHandle = 0,
+
+			/*!
+			** \brief Number of swap regions
+			**
+			** The region 0 is the default one, the others are used by the
+			** years simulated in parallel (one per numSpace)
+			*/
+			regionCount = 257,
 		};
 
 	public:
@@ -422,6 +434,23 @@ namespace Antares
 		*/
 		void flushAll();
 
+		/*!
+		** \brief Flush into swap files the memory mapped by the region of the calling thread
+		**
+		** The memory mapped by the other threads is not affected. The blocks
+		** which have also been acquired by another region are shared : they
+		** belong to the region 0 and are only unmapped by flushAll().
+		*/
+		void flushRegion();
+
+		/*!
+		** \brief Select the swap region of the calling thread
+		**
+		** All blocks mapped afterwards by the thread will belong to this region.
+		** \see flushRegion()
+		*/
+		static void SelectRegion(uint region);
+
 		/*!
 		** \brief Get the amount of memory currently used
 		*/
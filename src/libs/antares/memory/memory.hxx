@@ -172,6 +172,11 @@ namespace Antares
 	{
 		// Do nothing
 	}
+
+	inline void Memory::flushRegion()
+	{
+		// Do nothing
+	}
 	# endif
 
 
@@ -72,41 +72,45 @@ namespace Antares
 	}
 
 
-	MersenneTwister::Value MersenneTwister::next() const
+	void MersenneTwister::twist() const
 	{
 		uint32 y;
 		static const uint32 mag01[2] = {0x0UL, MATRIX_A};
-
 		// mag01[x] = x * MATRIX_A  for x=0,1
-		if (mti >= periodN) // generate N words at one time
-		{
-			if (mti == periodN + 1)
-			{
-				// if init_genrand() has not been called,
-				// a default initial seed is used
-				///reset(5489UL);
-				assert("Mersenne Twister should already been initialized !");
-			}
 
-			int kk;
-			for (kk = 0; kk < periodN - periodM; ++kk)
-			{
-				y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
-				mt[kk] = mt[kk + periodM] ^ (y >> 1) ^ mag01[y & 0x1UL];
-			}
+		if (mti == periodN + 1)
+		{
+			// if init_genrand() has not been called,
+			// a default initial seed is used
+			///reset(5489UL);
+			assert("Mersenne Twister should already been initialized !");
+		}
 
-			for (; kk < periodN-1; ++kk)
-			{
-				y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
-				mt[kk] = mt[kk + (periodM-periodN)] ^ (y >> 1) ^ mag01[y & 0x1UL];
-			}
+		int kk;
+		for (kk = 0; kk < periodN - periodM; ++kk)
+		{
+			y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
+			mt[kk] = mt[kk + periodM] ^ (y >> 1) ^ mag01[y & 0x1UL];
+		}
 
-			y = (mt[periodN-1] & UPPER_MASK) | (mt[0] & LOWER_MASK);
-			mt[periodN-1] = mt[periodM-1] ^ (y >> 1) ^ mag01[y & 0x1UL];
-			mti = 0;
+		for (; kk < periodN-1; ++kk)
+		{
+			y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
+			mt[kk] = mt[kk + (periodM-periodN)] ^ (y >> 1) ^ mag01[y & 0x1UL];
 		}
 
-		y = mt[mti++];
+		y = (mt[periodN-1] & UPPER_MASK) | (mt[0] & LOWER_MASK);
+		mt[periodN-1] = mt[periodM-1] ^ (y >> 1) ^ mag01[y & 0x1UL];
+		mti = 0;
+	}
+
+
+	MersenneTwister::Value MersenneTwister::next() const
+	{
+		if (mti >= periodN) // generate N words at one time
+			twist();
+
+		uint32 y = mt[mti++];
 
 		/* Tempering */
 		y ^= (y >> 11);
@@ -118,5 +122,24 @@ namespace Antares
 	}
 
 
+	void MersenneTwister::discard(uint64 count)
+	{
+		while (count != 0)
+		{
+			if (mti >= periodN)
+				twist();
+
+			uint64 available = (uint64) (periodN - mti);
+			if (count < available)
+			{
+				mti += (sint32) count;
+				return;
+			}
+			count -= available;
+			mti = periodN;
+		}
+	}
+
+
 
 } // namespace Antares
@@ -87,6 +87,15 @@ namespace Antares
 		**   break the global design
 		*/
 		Value next() const;
+
+		/*!
+		** \brief Skip the next random numbers
+		**
+		** This is equivalent to `count` calls to next(), the numbers
+		** themselves being not computed. Only the state vector is
+		** regenerated, once every 624 numbers.
+		*/
+		void discard(Yuni::uint64 count);
 		//@}
 
 		//! \name Bounds
@@ -98,6 +107,10 @@ namespace Antares
 		//@}
 
 
+	private:
+		//! Generate the next N words of the state vector
+		void twist() const;
+
 	private:
 		enum
 		{
@@ -39,6 +39,9 @@
 #include "../filter.h"
 #include "constants.h"
 #include "../../../internet/limits.h"
+#include <yuni/job/job.h>
+#include <yuni/job/queue/service.h>
+#include <vector>
 
 #define SEP IO::Separator
 
@@ -760,8 +763,16 @@ namespace Data
 
 
 
+	/*!
+	** \brief Load the data of a single area which do not depend on the other areas
+	**
+	** This routine may be called simultaneously for different areas (see
+	** AreaList::loadFromFolder()), thus it must not rely on the temporary buffers
+	** of the study. The links and the renaming of the thermal clusters are
+	** handled by AreaListLoadFromFolderSingleAreaLinks().
+	*/
 	template<class StringT>
-	static bool AreaListLoadFromFolderSingleArea(Study& study, AreaList* list, Area& area,
+	static bool AreaListLoadFromFolderSingleAreaData(Study& study, Area& area,
 		StringT& buffer, const StudyLoadOptions& options)
 	{
 		// Progression
@@ -910,17 +921,6 @@ namespace Data
 		++options.progressTicks;
 		options.pushProgressLogs();
 
-		// Links
-		{
-			if (study.header.version < 350)
-				buffer.clear() << study.folderInput << SEP << "interconnections" << SEP << area.id;
-			else
-				buffer.clear() << study.folderInput << SEP << "links" << SEP << area.id;
-			ret = AreaLinksLoadFromFolder(study, list, &area, buffer) and ret;
-			++options.progressTicks;
-			options.pushProgressLogs();
-		}
-
 		// UI
 		if (JIT::usedFromGUI)
 		{
@@ -1034,31 +1034,6 @@ namespace Data
 				}
 			}
 
-			if (study.header.version < 390)
-			{
-				// we must use an intermediate list since the original one will be
-				// altered by the rename
-				std::vector<Data::ThermalCluster*>  list;
-				area.thermal.list.each([&] (Data::ThermalCluster& cluster)
-				{
-					list.push_back(&cluster);
-				});
-
-				foreach (auto* cluster, list)
-				{
-					// We may have some strange name/id in older studies
-					// force full reloading
-					cluster->invalidate(true);
-					// marking the thermal plant as modified
-					cluster->markAsModified();
-
-					// applying the new naming convention
-					String newname;
-					BeautifyName(newname, cluster->name());
-					study.thermalClusterRename(cluster, newname, true);
-				}
-			}
-
 			// In adequacy mode, all thermal clusters must be in 'mustrun' mode
 			if (study.usedByTheSolver and study.parameters.mode == stdmAdequacy)
 				area.thermal.list.enableMustrunForEveryone();
@@ -1176,6 +1151,109 @@ namespace Data
 	}
 
 
+	/*!
+	** \brief Load the links of a single area and rename its thermal clusters if required
+	**
+	** Both operations modify the other areas or the study itself, thus this routine
+	** must always be called sequentially, after AreaListLoadFromFolderSingleAreaData().
+	*/
+	template<class StringT>
+	static bool AreaListLoadFromFolderSingleAreaLinks(Study& study, AreaList* list, Area& area,
+		StringT& buffer)
+	{
+		bool ret = true;
+
+		// Links
+		{
+			if (study.header.version < 350)
+				buffer.clear() << study.folderInput << SEP << "interconnections" << SEP << area.id;
+			else
+				buffer.clear() << study.folderInput << SEP << "links" << SEP << area.id;
+			ret = AreaLinksLoadFromFolder(study, list, &area, buffer) and ret;
+		}
+
+		// Thermal clusters
+		if (study.header.version < 390)
+		{
+			// we must use an intermediate list since the original one will be
+			// altered by the rename
+			std::vector<Data::ThermalCluster*>  list;
+			area.thermal.list.each([&] (Data::ThermalCluster& cluster)
+			{
+				list.push_back(&cluster);
+			});
+
+			foreach (auto* cluster, list)
+			{
+				// We may have some strange name/id in older studies
+				// force full reloading
+				cluster->invalidate(true);
+				// marking the thermal plant as modified
+				cluster->markAsModified();
+
+				// applying the new naming convention
+				String newname;
+				BeautifyName(newname, cluster->name());
+				study.thermalClusterRename(cluster, newname, true);
+			}
+
+			// flush
+			area.thermal.list.flush();
+		}
+		return ret;
+	}
+
+
+	namespace // anonymous
+	{
+
+		/*!
+		** \brief Job for loading the data of some areas (see AreaListLoadFromFolderSingleAreaData())
+		**
+		** The job handles the areas firstArea, firstArea + step, ... and keeps
+		** the status of each of them.
+		*/
+		class AreaListLoadJob final : public Yuni::Job::IJob
+		{
+		public:
+			AreaListLoadJob(Study& pStudy, const std::vector<Area*>& pAreas, std::vector<char>& pResults,
+				const StudyLoadOptions& pOptions, uint pFirstArea, uint pStep) :
+				study(pStudy),
+				areas(pAreas),
+				results(pResults),
+				options(pOptions),
+				firstArea(pFirstArea),
+				step(pStep)
+			{}
+
+		private:
+			virtual void onExecute() override
+			{
+				Clob buffer;
+				for (uint i = firstArea; i < (uint) areas.size(); i += step)
+				{
+					Area& area = *(areas[i]);
+					options.logMessage.clear() << "Loading the area " << (i + 1) << '/' << areas.size()
+						<< ": " << area.name;
+					logs.info() << options.logMessage;
+
+					results[i] = AreaListLoadFromFolderSingleAreaData(study, area, buffer, options) ? 1 : 0;
+				}
+			}
+
+		private:
+			Study& study;
+			const std::vector<Area*>& areas;
+			std::vector<char>& results;
+			//! Our own copy of the options, for the progression
+			StudyLoadOptions options;
+			uint firstArea;
+			uint step;
+		};
+
+	} // anonymous namespace
+
+
 	bool AreaList::loadFromFolder(const StudyLoadOptions& options)
 	{
 		bool ret = true;
@@ -1242,17 +1320,65 @@ namespace Data
 			pStudy.ensureDataAreAllInitialized();
 
 		// Load all nodes
-		uint indx = 0;
-		each([&] (Data::Area& area)
+		uint nbThreads = options.maxNbLoadThreads;
+		if (nbThreads > areas.size())
+			nbThreads = (uint) areas.size();
+
+		if (nbThreads <= 1)
 		{
-			// Progression
-			options.logMessage.clear() << "Loading the area " << (++indx) << '/' << areas.size()
-				<< ": " << area.name;
-			logs.info() << options.logMessage;
+			uint indx = 0;
+			each([&] (Data::Area& area)
+			{
+				// Progression
+				options.logMessage.clear() << "Loading the area " << (++indx) << '/' << areas.size()
+					<< ": " << area.name;
+				logs.info() << options.logMessage;
+
+				// Load a single area
+				ret = AreaListLoadFromFolderSingleAreaData(pStudy, area, buffer, options) and ret;
+				ret = AreaListLoadFromFolderSingleAreaLinks(pStudy, this, area, buffer) and ret;
+				++options.progressTicks;
+				options.pushProgressLogs();
+			});
+		}
+		else
+		{
+			logs.info() << "Loading the areas with " << nbThreads << " threads...";
 
-			// Load a single area
-			ret = AreaListLoadFromFolderSingleArea(pStudy, this, area, buffer, options) and ret;
-		});
+			std::vector<Area*> list;
+			list.reserve(areas.size());
+			each([&] (Data::Area& area)
+			{
+				list.push_back(&area);
+			});
+			std::vector<char> results(list.size(), 0);
+
+			// Data of the areas, in parallel
+			{
+				pStudy.areasLoadedInParallel = true;
+				Yuni::Job::QueueService qs;
+				qs.maximumThreadCount(nbThreads);
+				qs.start();
+				for (uint t = 0; t != nbThreads; ++t)
+					qs.add(new AreaListLoadJob(pStudy, list, results, options, t, nbThreads));
+				qs.wait(Yuni::qseIdle);
+				qs.stop();
+				pStudy.areasLoadedInParallel = false;
+			}
+
+			// Links and errors, in the order of the areas
+			for (uint i = 0; i != (uint) list.size(); ++i)
+			{
+				Area& area = *(list[i]);
+				if (not results[i])
+				{
+					logs.error() << "Loading the area " << (i + 1) << '/' << list.size()
+						<< ": " << area.name << ": some data could not be loaded";
+					ret = false;
+				}
+				ret = AreaListLoadFromFolderSingleAreaLinks(pStudy, this, area, buffer) and ret;
+			}
+		}
 
 		// update nameid set
 		updateNameIDSet();
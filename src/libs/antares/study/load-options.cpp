@@ -47,6 +47,7 @@ namespace Data
 		enableParallel(false),
 		forceParallel(false),
 		maxNbYearsInParallel(0),
+		maxNbLoadThreads(1),
 		usedByTheSolver(false),
 		mpsToExport(false)
 	{}
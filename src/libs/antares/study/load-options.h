@@ -82,6 +82,9 @@ namespace Data
 		bool forceParallel;
 		uint maxNbYearsInParallel;
 
+		//! Number of threads for loading the areas (0 or 1 to load them sequentially)
+		uint maxNbLoadThreads;
+
 		//! A non-zero value if the data will be used for a simulation
 		bool usedByTheSolver;
 
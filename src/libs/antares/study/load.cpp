@@ -464,7 +464,7 @@ namespace Data
 
 	bool Study::reloadXCastData()
 	{
-		// if changes are required, please update AreaListLoadFromFolderSingleArea()
+		// if changes are required, please update AreaListLoadFromFolderSingleAreaData()
 		bool ret = true;
 		areas.each ([&] (Data::Area& area)
 		{
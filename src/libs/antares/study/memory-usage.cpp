@@ -53,7 +53,8 @@ namespace Data
 		years(s.parameters.nbYears),
 		nbYearsParallel(s.maxNbYearsInParallel),
 		buffer(nullptr),
-		area(nullptr)
+		area(nullptr),
+		hourlySynthesis(true)
 	{
 		// alias to parameters
 		auto& parameters = study.parameters;
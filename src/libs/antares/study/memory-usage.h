@@ -116,6 +116,8 @@ namespace Data
 
 		//! The current area
 		const Area* area;
+		//! Whether the hourly results throughout all years are kept for the current area or link
+		bool hourlySynthesis;
 
 	private:
 		//! The number of simulation hours for a year
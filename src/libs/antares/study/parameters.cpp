@@ -233,6 +233,8 @@ namespace Data
 		// readonly
 		readonly               = false;
 		synthesis              = true;
+		binaryResults          = false;
+		mcQuantiles            = false;
 
 		// Shedding strategies
 		power.fluctuations     = lssFreeModulations;
@@ -259,6 +261,9 @@ namespace Data
 		include.reserve.spinning       = true;
 		include.reserve.primary        = true;
 		simplexOptimizationRange       = sorWeek;
+		warmStartAcrossYears           = false;
+		replayPresolve                 = false;
+		simplexPricingThreads          = 1;
 
 		include.exportMPS              = false;
 
@@ -328,6 +333,14 @@ namespace Data
 	}
 
 
+	static bool SGDIntLoadFamily_B(Parameters& d, const String& key, const String& value, uint)
+	{
+		if (key == "binary-results")
+			return value.to<bool>(d.binaryResults);
+		return false;
+	}
+
+
 	static bool SGDIntLoadFamily_C(Parameters& d, const String& key, const String& value, uint)
 	{
 		// Same time-series
@@ -467,6 +480,8 @@ namespace Data
 	{
 		if (key == "mode")
 			return StringToStudyMode(d.mode, value);
+		if (key == "mc-quantiles")
+			return value.to<bool>(d.mcQuantiles);
 		// Error
 		return false;
 	}
@@ -588,6 +603,8 @@ namespace Data
 		// What timeSeries to refresh ?
 		if (key == "refreshtimeseries")
 			return ConvertCStrToListTimeSeries(value, d.timeSeriesToRefresh);
+		if (key == "replay-presolve")
+			return value.to<bool>(d.replayPresolve);
 		// readonly
 		if (key == "readonly")
 			return value.to<bool>(d.readonly);
@@ -668,6 +685,8 @@ namespace Data
 						d.simplexOptimizationRange = (!value.ifind("day")) ? sorDay : sorWeek;
 						return true;
 					}
+					if (key == "simplex-pricing-threads")
+						return value.to<uint>(d.simplexPricingThreads);
 					if (key == "simulation.start")
 					{
 						uint day;
@@ -787,6 +806,15 @@ namespace Data
 	}
 
 
+	static bool SGDIntLoadFamily_W(Parameters& d, const String& key, const String& value, uint)
+	{
+		if (key == "warm-start-across-years")
+			return value.to<bool>(d.warmStartAcrossYears);
+		// Error
+		return false;
+	}
+
+
 	static bool SGDIntLoadFamily_Y(Parameters& d, const String& key, const String& value, uint)
 	{
 		if (key == "year-by-year")
@@ -809,7 +837,7 @@ namespace Data
 		static Callback jumper [] =
 		{
 			& SGDIntLoadFamily_A,
-			nullptr,
+			& SGDIntLoadFamily_B,
 			& SGDIntLoadFamily_C,
 			& SGDIntLoadFamily_D,
 			nullptr,
@@ -830,7 +858,7 @@ namespace Data
 			& SGDIntLoadFamily_T,
 			& SGDIntLoadFamily_U,
 			nullptr,
-			nullptr,
+			& SGDIntLoadFamily_W,
 			nullptr,
 			& SGDIntLoadFamily_Y,
 			nullptr,
@@ -952,6 +980,13 @@ namespace Data
 			logs.warning() << "The block size for the adequacy algorithm is invalid (100 <= blocksize <= 100000). Reset to " << adequacyBlockSize << '.';
 		}
 
+		// Simplex pricing threads
+		if (simplexPricingThreads < 1 || simplexPricingThreads > 64)
+		{
+			simplexPricingThreads = 1;
+			logs.warning() << "The number of simplex pricing threads is invalid (1 <= threads <= 64). Reset to 1.";
+		}
+
 		if (derated)
 		{
 			// Force the number of years
@@ -1040,6 +1075,12 @@ namespace Data
 			case sorUnknown:
 				break;
 		}
+		if (warmStartAcrossYears)
+			logs.info() << "  simplex warm start across years";
+		if (replayPresolve)
+			logs.info() << "  replay of the presolve reductions across weeks";
+		if (simplexPricingThreads > 1)
+			logs.info() << "  simplex pricing threads: " << simplexPricingThreads;
 
 		if (mode == stdmAdequacyDraft)
 		{
@@ -1200,6 +1241,8 @@ namespace Data
 			logs.info() << "  :: enabling the custom build mode";
 		if (filtering)
 			logs.info() << "  :: enabling filtering";
+		if (mcQuantiles)
+			logs.info() << "  :: enabling the quantiles in the synthesis";
 
 		if (!include.constraints)
 			logs.info() << "  :: ignoring binding constraints";
@@ -1315,6 +1358,8 @@ namespace Data
 			auto* section = ini.addSection("output");
 			section->add("synthesis", synthesis);
 			section->add("storeNewSet", storeTimeseriesNumbers);
+			section->add("binary-results", binaryResults);
+			section->add("mc-quantiles", mcQuantiles);
 			ParametersSaveTimeSeries(section, "archives", timeSeriesToArchive);
 		}
 
@@ -1328,6 +1373,9 @@ namespace Data
 				case sorWeek: section->add("simplex-range", "week");break;
 				case sorUnknown: break;
 			}
+			section->add("warm-start-across-years", warmStartAcrossYears);
+			section->add("replay-presolve", replayPresolve);
+			section->add("simplex-pricing-threads", simplexPricingThreads);
 			// Optimization preferences
 			switch (transmissionCapacities)
 			{
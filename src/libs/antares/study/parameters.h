@@ -317,6 +317,10 @@ namespace Data
 
 		//! Write the simulation synthesis into the output
 		bool synthesis;
+		//! Also write the results in the binary columnar format (.bin files)
+		bool binaryResults;
+		//! Write the quantiles (P10, P50, P90) throughout all years in the synthesis, when available
+		bool mcQuantiles;
 
 		//! \name Optimization
 		//@{
@@ -410,6 +414,28 @@ namespace Data
 		TransmissionCapacities transmissionCapacities;
 		//! Simplex optimization range (day/week)
 		SimplexOptimization  simplexOptimizationRange;
+		/*!
+		** \brief Start the simplex from the optimal basis of the same week of the previous year
+		**
+		** The previous year is the one simulated before on the same numSpace. Thus the
+		** results of degenerate problems may depend on the number of years in parallel.
+		*/
+		bool warmStartAcrossYears;
+		/*!
+		** \brief Replay the presolve reductions of the first week in the following ones
+		**
+		** Only used by the PNE solver (unit commitment with start-up costs). The reductions
+		** which did nothing on the first week solved by a numSpace are skipped afterwards.
+		*/
+		bool replayPresolve;
+		/*!
+		** \brief Number of threads sharing the pricing of each dual simplex iteration
+		**
+		** 1 (default) keeps the pricing sequential. The threads are added to the ones
+		** of the years simulated in parallel, it is useful when a few large weeks
+		** are solved at once.
+		*/
+		uint simplexPricingThreads;
 		//@}
 
 		//! \name Scenariio Builder - Rules
@@ -170,7 +170,7 @@ namespace Data
 		};
 
 		data.resize(hydroPreproMax, 12, true);
-		String& buffer = s.bufferLoadingTS;
+		String buffer;
 
 		buffer.clear() << folder << SEP << areaID << SEP << "prepro.ini";
 		bool ret = (PreproHydroLoadSettings(this, buffer.c_str()) ? true : false);
@@ -262,7 +262,7 @@ namespace Data
 		else
 		{
 			buffer.clear() << folder << SEP << areaID << SEP << "energy.txt";
-			ret = data.loadFromCSVFile(buffer, hydroPreproMax, 12, Matrix<>::optFixedSize, &s.dataBuffer) && ret;
+			ret = data.loadFromCSVFile(buffer, hydroPreproMax, 12, Matrix<>::optFixedSize, s.dataBufferForLoading()) && ret;
 		}
 
 		if (JIT::enabled)
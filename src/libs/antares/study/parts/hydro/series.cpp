@@ -77,7 +77,8 @@ namespace Data
 	bool DataSeriesHydro::loadFromFolder(Study& study, const AreaName& areaID, const AnyString& folder)
 	{
 		bool ret = true;
-		auto& buffer = study.bufferLoadingTS;
+		String buffer;
+		auto* dataBuffer = study.dataBufferForLoading();
 
 		// Before 3.9, the file was fatal.txt, and was a matrix N x DAYX_PER_YEAR
 		buffer.clear() << folder << SEP << areaID << SEP << "ror." << study.inputExtension;
@@ -92,7 +93,7 @@ namespace Data
 				options = Matrix<>::optImmediate, // | Matrix<>::optQuiet,
 			};
 
-			ret = tmp.loadFromCSVFile(buffer, 1, DAYS_PER_YEAR, options, &study.dataBuffer) && ret;
+			ret = tmp.loadFromCSVFile(buffer, 1, DAYS_PER_YEAR, options, dataBuffer) && ret;
 			if (ret)
 			{
 				if (tmp.height != DAYS_PER_YEAR)
@@ -127,11 +128,11 @@ namespace Data
 		}
 		else
 		{
-			ret = ror.loadFromCSVFile(buffer, 1, HOURS_PER_YEAR, &study.dataBuffer) && ret;
+			ret = ror.loadFromCSVFile(buffer, 1, HOURS_PER_YEAR, dataBuffer) && ret;
 		}
 
 		buffer.clear() << folder << SEP << areaID << SEP << "mod." << study.inputExtension;
-		ret = storage.loadFromCSVFile(buffer, 1, 12, &study.dataBuffer) && ret;
+		ret = storage.loadFromCSVFile(buffer, 1, 12, dataBuffer) && ret;
 
 		// The number of time-series
 		count = storage.width;
@@ -51,12 +51,12 @@ namespace Data
 		assert(folder);
 		assert('\0' != *folder);
 
-		auto& buffer = study.buffer;
+		String buffer;
 
 		int ret = 1;
 		/* Load the matrix */
 		buffer.clear() << folder << SEP << "load_" << areaID << '.' << study.inputExtension;
-		ret = s->series.loadFromCSVFile(buffer, 1, HOURS_PER_YEAR, &study.dataBuffer) && ret;
+		ret = s->series.loadFromCSVFile(buffer, 1, HOURS_PER_YEAR, study.dataBufferForLoading()) && ret;
 
 		if (study.usedByTheSolver && study.parameters.derated)
 			s->series.averageTimeseries();
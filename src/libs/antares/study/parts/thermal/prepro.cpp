@@ -106,7 +106,7 @@ namespace Data
 		const AnyString& clustername)
 	{
 		bool ret = true;
-		auto& buffer = study.bufferLoadingTS;
+		String buffer;
 
 		if (study.header.version < 350)
 		{
@@ -128,7 +128,7 @@ namespace Data
 				{
 					flags = Matrix<>::optFixedSize | Matrix<>::optImmediate,
 				};
-				if (tmp.loadFromCSVFile(buffer, 4, DAYS_PER_YEAR, flags, &study.dataBuffer))
+				if (tmp.loadFromCSVFile(buffer, 4, DAYS_PER_YEAR, flags, study.dataBufferForLoading()))
 				{
 					for (uint x = 0; x != 4; ++x)
 						data.pasteToColumn(x, tmp.column(x));
@@ -162,7 +162,7 @@ namespace Data
 			else
 			{
 				// standard loading
-				ret = data.loadFromCSVFile(buffer, thermalPreproMax, DAYS_PER_YEAR, Matrix<>::optFixedSize, &study.dataBuffer) and ret;
+				ret = data.loadFromCSVFile(buffer, thermalPreproMax, DAYS_PER_YEAR, Matrix<>::optFixedSize, study.dataBufferForLoading()) and ret;
 			}
 		}
 
@@ -97,6 +97,8 @@ namespace Data
 		activeLayerID(0),
 		showAllLayer(true)
 	{
+		areasLoadedInParallel = false;
+
 		// TS generators
 		for (uint i = 0; i != timeSeriesCount; ++i)
 			cacheTSGenerator[i] = nullptr;
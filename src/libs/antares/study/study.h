@@ -767,6 +767,19 @@ namespace Data
 		mutable Matrix<>::BufferType dataBuffer;
 		//! A buffer used when loading time-series for dealing with filenames (prepro/series only)
 		mutable YString bufferLoadingTS;
+		//! True while the areas are loaded by several threads (see AreaList::loadFromFolder())
+		bool areasLoadedInParallel;
+
+		/*!
+		** \brief The buffer to use for loading a matrix (prepro/series)
+		**
+		** The shared `dataBuffer`, or nullptr while the areas are loaded in
+		** parallel: each matrix then uses its own buffer.
+		*/
+		Matrix<>::BufferType* dataBufferForLoading() const
+		{
+			return (areasLoadedInParallel) ? nullptr : &dataBuffer;
+		}
 		//@}
 
 
@@ -47,6 +47,9 @@ set(SRC_VARIABLE_STORAGE
 		variable/storage/averagedata.h
 		variable/storage/averagedata.cpp
 		variable/storage/stdDeviation.h
+		variable/storage/quantiles.h
+		variable/storage/quantiles-data.h
+		variable/storage/quantiles-data.cpp
 		variable/storage/and.h
 		variable/storage/fwd.h
 		)
@@ -37,6 +37,7 @@ DONNEES_MENSUELLES * H2O_J_Instanciation( void );
 void H2O_J_OptimiserUnMois( DONNEES_MENSUELLES * );
 char H2O_J_EcrireJeuDeDonneesLineaireAuFormatMPS( DONNEES_MENSUELLES * , FILE * );
 void H2O_J_Free( DONNEES_MENSUELLES * );		
+void H2O_J_ReinitialiserLesProblemesSpx( DONNEES_MENSUELLES * );
 void H2O_J_ConstruireLesContraintes( int , int * , int , int , int * , char * , int * , double * , int * , CORRESPONDANCE_DES_CONTRAINTES * );
 void H2O_j_ConstruireLesVariables( int , int * , double * , double * , int * , double ** , CORRESPONDANCE_DES_VARIABLES * );
 void H2O_J_InitialiserLesBornesdesVariables( DONNEES_MENSUELLES * , int );
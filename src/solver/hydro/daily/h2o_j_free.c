@@ -108,3 +108,26 @@ free( DonneesMensuelles );
 
 return;	
 }
+
+
+
+/* Libere les problemes simplexe conserves pour le hot start : la resolution suivante repart
+   d'une base vierge, comme si le probleme venait d'etre instancie */
+void H2O_J_ReinitialiserLesProblemesSpx( DONNEES_MENSUELLES * DonneesMensuelles )
+{
+int i; PROBLEME_SPX * ProbSpx;
+
+PROBLEME_HYDRAULIQUE * ProblemeHydraulique;
+
+ProblemeHydraulique = DonneesMensuelles->ProblemeHydraulique;
+
+for ( i = 0 ; i < ProblemeHydraulique->NombreDeProblemes ; i++ ) {
+	ProbSpx = (PROBLEME_SPX *) ProblemeHydraulique->ProblemeSpx[i];
+	if ( ProbSpx != NULL ) {
+		SPX_LibererProbleme( ProbSpx );
+		ProblemeHydraulique->ProblemeSpx[i] = NULL;
+	}
+}
+
+return;
+}
@@ -201,7 +201,7 @@ namespace Antares
 			# endif
 
 
-			auto& problem = *H2O_J_Instanciation();
+			auto& problem = *(DONNEES_MENSUELLES*) pDailyProblems[numSpace];
 			problem.NombreDeJoursDuMois = (int) daysPerMonth;
 			problem.TurbineDuMois = data.MOG[realmonth];
 
@@ -227,8 +227,6 @@ namespace Antares
 					break;
 			}
 
-			H2O_J_Free(&problem);
-
 			# ifndef NDEBUG
 			for (uint day = 0; day != daysPerMonth; ++day)
 			{
@@ -276,8 +274,31 @@ namespace Antares
 
 
 
+	void HydroManagement::instantiateDailyProblems()
+	{
+		// One problem per numSpace : its 4 linear problems (28 to 31 days) are built once
+		// and only their bounds and right-hand sides change from one month to the other
+		pDailyProblems = new void*[study.maxNbYearsInParallel];
+		for (uint numSpace = 0; numSpace != study.maxNbYearsInParallel; ++numSpace)
+			pDailyProblems[numSpace] = H2O_J_Instanciation();
+	}
+
+
+	void HydroManagement::releaseDailyProblems()
+	{
+		for (uint numSpace = 0; numSpace != study.maxNbYearsInParallel; ++numSpace)
+			H2O_J_Free((DONNEES_MENSUELLES*) pDailyProblems[numSpace]);
+		delete[] pDailyProblems;
+	}
+
+
 	void HydroManagement::prepareDailyOptimalGenerations(uint numSpace)
 	{
+		// The simplex problems are hot-started from one month and one area to the next
+		// within a year, but each year starts from scratch : the results of a year do not
+		// depend on the years previously computed on the same numSpace
+		H2O_J_ReinitialiserLesProblemesSpx((DONNEES_MENSUELLES*) pDailyProblems[numSpace]);
+
 		study.areas.each([&] (Data::Area& area)
 		{
 			prepareDailyOptimalGenerations(area, numSpace);
@@ -93,6 +93,9 @@ namespace Antares
 		for(uint numSpace = 0; numSpace < study.maxNbYearsInParallel; numSpace++)
 			pAreas[numSpace] = new PerArea[study.areas.size()];
 
+		instantiateMonthlyProblems();
+		instantiateDailyProblems();
+
 		
 		random.reset(study.parameters.seed[Data::seedHydroManagement]);
 	}
@@ -100,6 +103,9 @@ namespace Antares
 
 	HydroManagement::~HydroManagement()
 	{
+		releaseMonthlyProblems();
+		releaseDailyProblems();
+
 		for(uint numSpace = 0; numSpace < study.maxNbYearsInParallel; numSpace++)
 			delete[] pAreas[numSpace];
 		delete[] pAreas;
@@ -85,6 +85,18 @@ namespace Antares
 		void prepareDailyOptimalGenerations(Data::Area& area, uint numSpace);
 		//@}
 
+		//! \name Hydro problems
+		//@{
+		//! Instantiate the monthly problem of each numSpace (see monthly.cpp)
+		void instantiateMonthlyProblems();
+		//! Release the monthly problems
+		void releaseMonthlyProblems();
+		//! Instantiate the daily problems of each numSpace (see daily.cpp)
+		void instantiateDailyProblems();
+		//! Release the daily problems
+		void releaseDailyProblems();
+		//@}
+
 		//! \name Utilities
 		//@{
 		//! Beta variable
@@ -135,6 +147,11 @@ namespace Antares
 		//! Temporary data per area
 		PerArea** pAreas;
 
+		//! Monthly problems (DONNEES_ANNUELLES), one per numSpace, reused for all areas
+		void** pMonthlyProblems;
+		//! Daily problems (DONNEES_MENSUELLES), one per numSpace, reused for all areas and months
+		void** pDailyProblems;
+
 	}; // class HydroManagement
 
 
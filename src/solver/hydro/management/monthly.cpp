@@ -140,8 +140,27 @@ namespace Antares
 		return total;
 	}
 
+	void HydroManagement::instantiateMonthlyProblems()
+	{
+		pMonthlyProblems = new void*[study.maxNbYearsInParallel];
+		for (uint numSpace = 0; numSpace != study.maxNbYearsInParallel; ++numSpace)
+			pMonthlyProblems[numSpace] = H2O_M_Instanciation(1);
+	}
+
+
+	void HydroManagement::releaseMonthlyProblems()
+	{
+		for (uint numSpace = 0; numSpace != study.maxNbYearsInParallel; ++numSpace)
+			H2O_M_Free((DONNEES_ANNUELLES*) pMonthlyProblems[numSpace]);
+		delete[] pMonthlyProblems;
+	}
+
+
 	void HydroManagement::prepareMonthlyOptimalGenerations(double * random_reservoir_level, uint numSpace)
 	{
+		// Same as the daily problems : hot start within a year only
+		H2O_M_ReinitialiserLesProblemesSpx((DONNEES_ANNUELLES*) pMonthlyProblems[numSpace]);
+
 		uint indexArea = 0;
 		study.areas.each([&] (Data::Area& area)
 		{
@@ -162,7 +181,7 @@ namespace Antares
 
 			if (area.hydro.reservoirManagement)
 			{
-				auto& problem = *H2O_M_Instanciation(1);
+				auto& problem = *(DONNEES_ANNUELLES*) pMonthlyProblems[numSpace];
 
 				
 				double totalInflowsYear = prepareMonthlyTargetGenerations(area, data);
@@ -206,8 +225,6 @@ namespace Antares
 						AntaresSolverEmergencyShutdown();
 						break;
 				}
-
-				H2O_M_Free(&problem);
 			}
 
 			else
@@ -36,6 +36,7 @@ DONNEES_ANNUELLES * H2O_M_Instanciation( int );
 void H2O_M_OptimiserUneAnnee( DONNEES_ANNUELLES * , int );
 char H2O_M_EcrireJeuDeDonneesLineaireAuFormatMPS( DONNEES_ANNUELLES * , FILE * );
 void H2O_M_Free( DONNEES_ANNUELLES * );
+void H2O_M_ReinitialiserLesProblemesSpx( DONNEES_ANNUELLES * );
 
 void H2O_M_ConstruireLesContraintes( DONNEES_ANNUELLES * );
 void H2O_M_ConstruireLesVariables( DONNEES_ANNUELLES * );
@@ -106,3 +106,26 @@ free( DonneesAnnuelles );
 
 return;	
 }
+
+
+
+/* Libere les problemes simplexe conserves pour le hot start : la resolution suivante repart
+   d'une base vierge, comme si le probleme venait d'etre instancie */
+void H2O_M_ReinitialiserLesProblemesSpx( DONNEES_ANNUELLES * DonneesAnnuelles )
+{
+int i; PROBLEME_SPX * ProbSpx;
+
+PROBLEME_HYDRAULIQUE * ProblemeHydraulique;
+
+ProblemeHydraulique = DonneesAnnuelles->ProblemeHydraulique;
+
+for ( i = 0 ; i < ProblemeHydraulique->NombreDeReservoirs ; i++ ) {
+  ProbSpx = (PROBLEME_SPX *) ProblemeHydraulique->ProblemeSpx[i];
+  if ( ProbSpx != NULL ) {
+	  SPX_LibererProbleme( ProbSpx );
+	  ProblemeHydraulique->ProblemeSpx[i] = NULL;
+  }
+}
+
+return;
+}
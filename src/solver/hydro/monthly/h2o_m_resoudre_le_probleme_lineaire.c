@@ -133,6 +133,8 @@ Probleme->LibererMemoireALaFin = NON_SPX;
 Probleme->UtiliserCoutMax = NON_SPX;
 Probleme->CoutMax = 0.0;
 
+Probleme->NombreDeThreadsDePricing = 1;
+
 Probleme->CoutsMarginauxDesContraintes = ProblemeLineairePartieVariable->CoutsMarginauxDesContraintes;
 Probleme->CoutsReduits                 = ProblemeLineairePartieVariable->CoutsReduits;
 
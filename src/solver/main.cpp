@@ -44,6 +44,7 @@
 #include "../config.h"
 #include <antares/emergency.h>
 #include <antares/memory/memory.h>
+#include <antares/array/matrix-cache.h>
 #include <antares/sys/policy.h>
 #include <antares/locale.h>
 #include "../internet/license.h"
@@ -136,6 +137,13 @@ bool SolverApplication::prepare(int argc, char* argv[])
 		logs.info() << "  memory pool: scratch folder:" << Antares::memory.cacheFolder();
 	# endif
 
+	// Binary cache of the input matrices
+	if (not pSettings.matrixCache.empty())
+	{
+		logs.info() << "  matrix cache: " << pSettings.matrixCache;
+		Antares::MatrixCache::Folder(pSettings.matrixCache);
+	}
+
 
 	// Initialize the main structures for the simulation
 	// Logs
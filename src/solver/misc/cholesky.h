@@ -45,6 +45,8 @@ namespace Solver
 	** Si A est definie positive ou semi-definie positive on acheve la factorisation
 	** Si A n'est pas definie positive on arrete la factorisation en cours de route
 	** On retourne un code qui indique si A est définie positive ou non
+	** La factorisation est effectuee par blocs de colonnes, pour limiter le nombre
+	** de parcours des lignes de L sur les grandes matrices
 	**
 	**   LtL = A si A est semi-definie positive
 	** \param      A matrice NxN a factoriser
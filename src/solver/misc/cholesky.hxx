@@ -34,65 +34,196 @@
 namespace Antares
 {
 namespace Solver
+{
+namespace Private
+{
+namespace CholeskyFactorization
 {
 
+	enum
+	{
+		//! Nombre de colonnes factorisees par bloc
+		blockSize = 32,
+		//! Nombre de termes par tranche pour la mise a jour d'un bloc
+		panelSize = 256,
+		//! Nombre d'accumulateurs independants pour les produits scalaires
+		lanes = 8,
+	};
+
+
+	/*!
+	** \brief Produit scalaire des termes [from, to[ de deux lignes
+	**
+	** Les sommes partielles sont reparties sur plusieurs accumulateurs
+	** independants, ce qui permet au compilateur de vectoriser la boucle.
+	*/
+	template<class T, class R1, class R2>
+	inline T DotProduct(const R1& a, const R2& b, uint from, uint to)
+	{
+		T acc[lanes] = {};
+		uint j = from;
+		for (; j + lanes <= to; j += lanes)
+		{
+			for (uint l = 0; l != lanes; ++l)
+				acc[l] += a[j + l] * b[j + l];
+		}
+
+		T som = T();
+		for (; j < to; ++j)
+			som += a[j] * b[j];
+		for (uint l = 0; l != lanes; ++l)
+			som += acc[l];
+		return som;
+	}
+
+
+	/*!
+	** \brief Produits scalaires des termes [from, to[ d'une ligne avec 4 autres lignes
+	**
+	** Chaque terme de la ligne `a` n'est lu qu'une seule fois pour les 4 produits.
+	*/
+	template<class T, class R1, class R2>
+	inline void DotProduct4(const R1& a, const R2& b0, const R2& b1, const R2& b2, const R2& b3,
+		uint from, uint to, T* result)
+	{
+		enum { l4 = lanes / 2 };
+		T acc0[l4] = {};
+		T acc1[l4] = {};
+		T acc2[l4] = {};
+		T acc3[l4] = {};
+		uint j = from;
+		for (; j + l4 <= to; j += l4)
+		{
+			for (uint l = 0; l != l4; ++l)
+			{
+				const T aj = a[j + l];
+				acc0[l] += aj * b0[j + l];
+				acc1[l] += aj * b1[j + l];
+				acc2[l] += aj * b2[j + l];
+				acc3[l] += aj * b3[j + l];
+			}
+		}
+
+		T s[4] = {};
+		for (; j < to; ++j)
+		{
+			s[0] += a[j] * b0[j];
+			s[1] += a[j] * b1[j];
+			s[2] += a[j] * b2[j];
+			s[3] += a[j] * b3[j];
+		}
+		for (uint l = 0; l != l4; ++l)
+		{
+			s[0] += acc0[l];
+			s[1] += acc1[l];
+			s[2] += acc2[l];
+			s[3] += acc3[l];
+		}
+		for (uint l = 0; l != 4; ++l)
+			result[l] = s[l];
+	}
+
+
+} // namespace CholeskyFactorization
+} // namespace Private
+
+
+
 
 	template<class T, class U1, class U2>
 	bool Cholesky(U1& L, U2& A, uint size, T* temp)
 	{
 		using namespace Yuni;
+		using namespace Private::CholeskyFactorization;
 
 		for (uint i = 0; i != size; ++i)
 			temp[i] = 0;
 
 		T som;
 
-		for (uint i = 0; i < size; ++i)
+		// La factorisation est effectuee par blocs de colonnes [i0, i1[
+		for (uint i0 = 0; i0 < size; i0 += blockSize)
 		{
-			typename MatrixSubColumn<U1>::Type Li = L[i];
+			const uint i1 = (i0 + blockSize < size) ? i0 + blockSize : size;
 
-			// on calcule d'abord L[i][i]
-			som = A[i][i];
-			for (int j = 0; j <= (int)(i - 1); ++j)
-				som -= Li[j] * Li[j];
-
-			if (som > ANTARES_CHOLESKY_EPSIMIN)
+			// Contribution des colonnes deja factorisees (j < i0) au bloc courant :
+			// L[k][i] = A[k][i] - sum(L[k][j] * L[i][j]).
+			// Les colonnes j sont parcourues par tranches, de sorte que les termes
+			// L[i][j] du bloc restent en cache pendant le parcours des lignes k
+			for (uint k = i0; k < size; ++k)
 			{
-				Li[i] = Math::SquareRootNoCheck(som);
+				typename MatrixSubColumn<U1>::Type Lk = L[k];
+				typename MatrixSubColumn<U2>::Type Ak = A[k];
 
-				// maintenant on cherche L[k][i], k > i.
-				for (uint k = i + 1; k < size; ++k)
+				const uint end = (k < i1) ? k + 1 : i1;
+				for (uint i = i0; i != end; ++i)
+					Lk[i] = Ak[i];
+			}
+			for (uint j0 = 0; j0 < i0; j0 += panelSize)
+			{
+				const uint j1 = (j0 + panelSize < i0) ? j0 + panelSize : i0;
+				for (uint k = i0; k < size; ++k)
 				{
 					typename MatrixSubColumn<U1>::Type Lk = L[k];
-					typename MatrixSubColumn<U2>::Type Ak = A[k];
 
-					if (temp[k] == Ak[k])
-					{
-						Lk[i] = 0;
-					}
-					else
+					const uint end = (k < i1) ? k + 1 : i1;
+					uint i = i0;
+					for (; i + 4 <= end; i += 4)
 					{
-						som = Ak[i];
-						for (int j = 0; j <= (int)(i - 1); ++j)
-							som -= Li[j] * Lk[j];
-
-						Lk[i]  = som / Li[i];
-						temp[k] += Lk[i] * Lk[i];
-
-						// si temp[k] = A[k][k] la matrice n'est pas dp mais il est encore possible
-						// qu'elle soit sdp.
-						// si temp > A[k][k] alors il est certain que A n'est ni sdp ni dp donc on
-						// arrete le calcul
-						if (temp[k] > Ak[k])
-							return true;
+						T som4[4];
+						DotProduct4<T>(Lk, L[i], L[i + 1], L[i + 2], L[i + 3], j0, j1, som4);
+						for (uint l = 0; l != 4; ++l)
+							Lk[i + l] -= som4[l];
 					}
+					for (; i != end; ++i)
+						Lk[i] -= DotProduct<T>(Lk, L[i], j0, j1);
 				}
 			}
-			else
+
+			// Factorisation du bloc, colonne par colonne
+			for (uint i = i0; i != i1; ++i)
 			{
-				// annule le reste de la colonne
-				for (uint k = i; k != size; ++k)
-					L[k][i] = 0;
+				typename MatrixSubColumn<U1>::Type Li = L[i];
+
+				// on calcule d'abord L[i][i]
+				som = Li[i] - DotProduct<T>(Li, Li, i0, i);
+
+				if (som > ANTARES_CHOLESKY_EPSIMIN)
+				{
+					Li[i] = Math::SquareRootNoCheck(som);
+
+					// maintenant on cherche L[k][i], k > i.
+					for (uint k = i + 1; k < size; ++k)
+					{
+						typename MatrixSubColumn<U1>::Type Lk = L[k];
+						typename MatrixSubColumn<U2>::Type Ak = A[k];
+
+						if (temp[k] == Ak[k])
+						{
+							Lk[i] = 0;
+						}
+						else
+						{
+							som = Lk[i] - DotProduct<T>(Li, Lk, i0, i);
+
+							Lk[i]  = som / Li[i];
+							temp[k] += Lk[i] * Lk[i];
+
+							// si temp[k] = A[k][k] la matrice n'est pas dp mais il est encore possible
+							// qu'elle soit sdp.
+							// si temp > A[k][k] alors il est certain que A n'est ni sdp ni dp donc on
+							// arrete le calcul
+							if (temp[k] > Ak[k])
+								return true;
+						}
+					}
+				}
+				else
+				{
+					// annule le reste de la colonne
+					for (uint k = i; k != size; ++k)
+						L[k][i] = 0;
+				}
 			}
 		}
 
@@ -31,8 +31,39 @@
 namespace Antares
 {
 namespace Solver
+{
+namespace Private
 {
 
+	/*!
+	** \brief B = r * A + (1 - r) * C, termes triangulaires inferieurs (diagonale exclue)
+	*/
+	template<class T, class U1, class U2, class U3>
+	void MatrixDPInterpolate(U1& B, U2& A, U3& C, uint size, T r, bool CIsIdentity)
+	{
+		const T rc = T(1) - r;
+		for (uint j = 0; j != size; ++j)
+		{
+			typename MatrixSubColumn<U1>::Type Bj = B[j];
+			typename MatrixSubColumn<U2>::Type Aj = A[j];
+			if (not CIsIdentity)
+			{
+				typename MatrixSubColumn<U3>::Type Cj = C[j];
+				for (uint k = 0; k < j; ++k)
+					Bj[k] = Aj[k] * r + Cj[k] * rc;
+			}
+			else
+			{
+				for (uint k = 0; k < j; ++k)
+					Bj[k] = Aj[k] * r; // + C[j][k] * (T(1) - r);
+			}
+		}
+	}
+
+} // namespace Private
+
+
+
 	template<class T, class U1, class U2, class U3, class U4>
 	T
 	MatrixDPMake(U1& L, U2& A, U3& B, U4& C, uint size, T* temp, bool CIsIdentity)
@@ -72,22 +103,7 @@ namespace Solver
 			for (uint i = 0; i != dichotomie; ++i)
 			{
 				r = (top + bot) / T(2);
-				if (not CIsIdentity)
-				{
-					for (uint j = 0; j != size; ++j)
-					{
-						for (uint k = 0; k < j; ++k)
-							B[j][k]  = A[j][k] * r + C[j][k] * (T(1) - r);
-					}
-				}
-				else
-				{
-					for (uint j = 0; j != size; ++j)
-					{
-						for (uint k = 0; k < j; ++k)
-							B[j][k]  = A[j][k] * r; // + C[j][k] * (T(1) - r);
-					}
-				}
+				Private::MatrixDPInterpolate<T>(B, A, C, size, r, CIsIdentity);
 
 				if (Cholesky<T>(L, B, size, temp))
 				{
@@ -105,22 +121,7 @@ namespace Solver
 				// la derniere matrice n'etait pas bonne, il faut recalculer
 				if (r != rho)
 				{
-					if (!CIsIdentity)
-					{
-						for (uint j = 0; j != size; ++j)
-						{
-							for (uint k = 0; k < j; ++k)
-								B[j][k] = A[j][k] * rho + C[j][k] * (T(1) - rho);
-						}
-					}
-					else
-					{
-						for (uint j = 0; j != size; ++j)
-						{
-							for (uint k = 0; k < j; ++k)
-								B[j][k] = A[j][k] * rho; // + C[j][k] * (T(1) - rho);
-						}
-					}
+					Private::MatrixDPInterpolate<T>(B, A, C, size, rho, CIsIdentity);
 					Cholesky<T>(L, B, size, temp);
 				}
 				return rho;
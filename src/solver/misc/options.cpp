@@ -92,6 +92,8 @@ bool GrabOptionsFromCommandLine(int argc, char* argv[], Settings& settings,
 	getopt.addFlag(options.enableParallel, ' ', "parallel", "Enable the parallel computation of MC years");
 	// --force-parallel
 	getopt.add(options.maxNbYearsInParallel, ' ', "force-parallel", "Override the max number of years computed simultaneously");
+	// --load-threads
+	getopt.add(options.maxNbLoadThreads, ' ', "load-threads", "Number of threads used to load the areas of the study (default: 1)");
 
 
 	getopt.addParagraph("\nParameters");
@@ -149,6 +151,9 @@ bool GrabOptionsFromCommandLine(int argc, char* argv[], Settings& settings,
 		"Folder where the swap files will be written. This option has no effect (swap files are only available for 'antares-solver-swap')"
 		# endif
 		);
+	// --matrix-cache
+	getopt.add(settings.matrixCache, ' ', "matrix-cache",
+		"Folder where binary copies of the input matrices are cached, to speed up the next loadings of the study");
 
 	// --pid
 	String optPID;
@@ -194,6 +199,12 @@ bool GrabOptionsFromCommandLine(int argc, char* argv[], Settings& settings,
 	if (options.maxNbYearsInParallel)
 		options.forceParallel = true;
 
+	if (options.maxNbLoadThreads > 256)
+	{
+		logs.error() << "Invalid number of threads for loading the study";
+		return false;
+	}
+
 	if (options.enableParallel && options.forceParallel)
 	{
 		logs.error() << "Options --parallel and --force-parallel are incompatible";
@@ -61,6 +61,8 @@ public:
 	bool displayProgression;
 	//! Swap folder
 	Yuni::String swap;
+	//! Folder of the binary cache of the input matrices (empty if disabled)
+	Yuni::String matrixCache;
 
 }; // class Settings
 
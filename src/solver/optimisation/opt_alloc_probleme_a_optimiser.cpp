@@ -37,11 +37,14 @@
 
 # include "../ext/Sirius_Solver/simplexe/spx_definition_arguments.h"
 # include "../ext/Sirius_Solver/simplexe/spx_fonctions.h"
+# include "../ext/Sirius_Solver/pne/pne_definition_arguments.h"
+# include "../ext/Sirius_Solver/pne/pne_fonctions.h"
 # include <stdio.h>
+# include <antares/study.h>
 
 static void optimisationAllocateProblem( PROBLEME_HEBDO * ProblemeHebdo, const int mxPaliers )
 {
-	int NbTermes; int NbIntervalles; int NumIntervalle; int i;
+	int NbTermes; int NbIntervalles; int NumIntervalle; int i; int NbSemaines; int NumBase;
 	size_t szNbVarsDouble; size_t szNbVarsint; size_t szNbContint;
   int NombreDePasDeTempsPourUneOptimisation;
 	
@@ -110,6 +113,22 @@ static void optimisationAllocateProblem( PROBLEME_HEBDO * ProblemeHebdo, const i
 			for ( NumIntervalle = 0; NumIntervalle < NbIntervalles ; NumIntervalle++ ) {
 				ProblemesSpxDUneClasseDeManoeuvrabilite[i]->ProblemeSpx[NumIntervalle] = NULL;
 			}
+			ProblemesSpxDUneClasseDeManoeuvrabilite[i]->NombreDIntervalles = NbIntervalles;
+
+			
+			ProblemesSpxDUneClasseDeManoeuvrabilite[i]->BasesDeLAnneePrecedente = NULL;
+			ProblemesSpxDUneClasseDeManoeuvrabilite[i]->NombreDeBases           = 0;
+			if ( ProblemeHebdo->RepartirDeLaBaseDeLAnneePrecedente == OUI_ANTARES ) {
+				auto& parameters = Antares::Data::Study::Current::Get()->parameters;
+				NbSemaines = (int) ((parameters.simulationDays.end - parameters.simulationDays.first) / 7);
+
+				ProblemesSpxDUneClasseDeManoeuvrabilite[i]->BasesDeLAnneePrecedente =
+					(BASE_SIMPLEXE **) MemAlloc(NbSemaines * NbIntervalles * sizeof( void * ));
+				ProblemesSpxDUneClasseDeManoeuvrabilite[i]->NombreDeBases = NbSemaines * NbIntervalles;
+				for ( NumBase = 0; NumBase < NbSemaines * NbIntervalles; NumBase++ ) {
+					ProblemesSpxDUneClasseDeManoeuvrabilite[i]->BasesDeLAnneePrecedente[NumBase] = NULL;
+				}
+			}
 		}
 	}
 
@@ -120,6 +139,15 @@ static void optimisationAllocateProblem( PROBLEME_HEBDO * ProblemeHebdo, const i
 	
 	ProblemeAResoudre->Pi      = (double *) MemAlloc( ProblemeAResoudre->NombreDeVariables * sizeof( double ) );
 	ProblemeAResoudre->Colonne = (int *)    MemAlloc( ProblemeAResoudre->NombreDeVariables * sizeof( int   ) );
+
+	
+	ProblemeAResoudre->SequenceDePresolve = NULL;
+	if ( ProblemeHebdo->RejouerLaSequenceDePresolve == OUI_ANTARES ) {
+		SEQUENCE_DE_PRESOLVE * Sequence = (SEQUENCE_DE_PRESOLVE *) MemAlloc( sizeof( SEQUENCE_DE_PRESOLVE ) );
+		Sequence->Enregistree = NON_PNE;
+		Sequence->Rejouee     = NON_PNE;
+		ProblemeAResoudre->SequenceDePresolve = (void *) Sequence;
+	}
 	
 }
 
@@ -130,6 +158,7 @@ void OPT_AllocDuProblemeAOptimiser( PROBLEME_HEBDO * ProblemeHebdo )
 	int mxPaliers; PROBLEME_ANTARES_A_RESOUDRE * ProblemeAResoudre;
 	ProblemeAResoudre = (PROBLEME_ANTARES_A_RESOUDRE *) MemAllocMemset(sizeof( PROBLEME_ANTARES_A_RESOUDRE ));
 	ProblemeHebdo->ProblemeAResoudre = ProblemeAResoudre;
+	ProblemeAResoudre->ClasseDeManoeuvrabiliteDeLaStructureConstruite = -1;
 
 	
 	
@@ -160,6 +189,26 @@ void OPT_AugmenterLaTailleDeLaMatriceDesContraintes( PROBLEME_ANTARES_A_RESOUDRE
 
 
 
+static void optimisationFreeBases( PROBLEMES_SIMPLEXE * ProblemesSpx )
+{
+	int NumBase; BASE_SIMPLEXE * Base;
+
+	if ( ProblemesSpx->BasesDeLAnneePrecedente == NULL ) return;
+
+	for ( NumBase = 0; NumBase < ProblemesSpx->NombreDeBases; NumBase++ ) {
+		Base = ProblemesSpx->BasesDeLAnneePrecedente[NumBase];
+		if ( Base != NULL ) {
+			MemFree( Base->PositionDeLaVariable );
+			MemFree( Base->ComplementDeLaBase );
+			MemFree( Base );
+		}
+	}
+	MemFree( ProblemesSpx->BasesDeLAnneePrecedente );
+	ProblemesSpx->BasesDeLAnneePrecedente = NULL;
+}
+
+
+
 void OPT_LiberationMemoireDuProblemeAOptimiser( PROBLEME_HEBDO * ProblemeHebdo )
 {
 int i; PROBLEME_ANTARES_A_RESOUDRE * ProblemeAResoudre;
@@ -188,6 +237,7 @@ if (ProblemeAResoudre)
 
 	if (ProblemeAResoudre->ProblemesSpxDUneClasseDeManoeuvrabilite) {
 		for ( i = 0; i < ProblemeHebdo->NombreDeClassesDeManoeuvrabiliteActives; ++i) {
+			optimisationFreeBases(ProblemeAResoudre->ProblemesSpxDUneClasseDeManoeuvrabilite[i]);
 			MemFree(ProblemeAResoudre->ProblemesSpxDUneClasseDeManoeuvrabilite[i]->ProblemeSpx);
 			MemFree(ProblemeAResoudre->ProblemesSpxDUneClasseDeManoeuvrabilite[i]);
 		}
@@ -198,6 +248,7 @@ if (ProblemeAResoudre)
 	MemFree( ProblemeAResoudre->ComplementDeLaBase );
 	MemFree( ProblemeAResoudre->Pi );
 	MemFree( ProblemeAResoudre->Colonne );
+	MemFree( ProblemeAResoudre->SequenceDePresolve );
 
 	MemFree( ProblemeAResoudre );
 
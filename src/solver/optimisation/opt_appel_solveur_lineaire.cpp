@@ -67,6 +67,82 @@ bool OPT_AppelDuSolveurPne( PROBLEME_HEBDO * , uint , int );
 
 
 
+/* Emplacement de la base de l'annee precedente pour la semaine et l'intervalle en cours.
+   NULL si on ne repart pas de la base de l'annee precedente. Seule la premiere optimisation
+   est concernee: la seconde repart de la base de la premiere, plus proche */
+static BASE_SIMPLEXE ** OPT_EmplacementDeLaBaseDeLAnneePrecedente( PROBLEME_ANTARES_A_RESOUDRE * ProblemeAResoudre,
+                                                                   PROBLEMES_SIMPLEXE * ProblemesSpx,
+                                                                   uint numSpace, int NumIntervalle )
+{
+int NumBase;
+
+if ( ProblemesSpx->BasesDeLAnneePrecedente == NULL ) return NULL;
+if ( ProblemeAResoudre->NumeroDOptimisation != PREMIERE_OPTIMISATION ) return NULL;
+
+NumBase = (int) Study::Current::Get()->runtime->weekInTheYear[numSpace] * ProblemesSpx->NombreDIntervalles + NumIntervalle;
+if ( NumBase < 0 || NumBase >= ProblemesSpx->NombreDeBases ) return NULL;
+
+return &(ProblemesSpx->BasesDeLAnneePrecedente[NumBase]);
+}
+
+
+static bool OPT_RestaurerLaBase( PROBLEME_ANTARES_A_RESOUDRE * ProblemeAResoudre, const BASE_SIMPLEXE * Base,
+                                 PROBLEME_SIMPLEXE & Probleme )
+{
+int Var;
+
+if ( Base == NULL ) return false;
+if ( Base->NombreDeVariables   != ProblemeAResoudre->NombreDeVariables
+  || Base->NombreDeContraintes != ProblemeAResoudre->NombreDeContraintes ) return false;
+
+for ( Var = 0 ; Var < Base->NombreDeVariables ; Var++ ) {
+	ProblemeAResoudre->PositionDeLaVariable[Var] = (int) Base->PositionDeLaVariable[Var];
+}
+Probleme.NbVarDeBaseComplementaires = Base->NbVarDeBaseComplementaires;
+memcpy( ProblemeAResoudre->ComplementDeLaBase, Base->ComplementDeLaBase, Base->NbVarDeBaseComplementaires * sizeof( int ) );
+
+return true;
+}
+
+
+static void OPT_SauvegarderLaBase( PROBLEME_ANTARES_A_RESOUDRE * ProblemeAResoudre, BASE_SIMPLEXE ** Emplacement,
+                                   const PROBLEME_SIMPLEXE & Probleme )
+{
+int Var; BASE_SIMPLEXE * Base;
+
+Base = *Emplacement;
+if ( Base != NULL && ( Base->NombreDeVariables   != ProblemeAResoudre->NombreDeVariables
+                    || Base->NombreDeContraintes != ProblemeAResoudre->NombreDeContraintes ) ) {
+	MemFree( Base->PositionDeLaVariable );
+	MemFree( Base->ComplementDeLaBase );
+	MemFree( Base );
+	Base = NULL;
+}
+if ( Base == NULL ) {
+	Base = (BASE_SIMPLEXE *) MemAlloc( sizeof( BASE_SIMPLEXE ) );
+	Base->NombreDeVariables                 = ProblemeAResoudre->NombreDeVariables;
+	Base->NombreDeContraintes               = ProblemeAResoudre->NombreDeContraintes;
+	Base->PositionDeLaVariable              = (char *) MemAlloc( Base->NombreDeVariables * sizeof( char ) );
+	Base->NbVarDeBaseComplementairesAlloues = 0;
+	Base->ComplementDeLaBase                = NULL;
+	*Emplacement = Base;
+}
+
+for ( Var = 0 ; Var < Base->NombreDeVariables ; Var++ ) {
+	Base->PositionDeLaVariable[Var] = (char) ProblemeAResoudre->PositionDeLaVariable[Var];
+}
+
+if ( Probleme.NbVarDeBaseComplementaires > Base->NbVarDeBaseComplementairesAlloues ) {
+	MemFree( Base->ComplementDeLaBase );
+	Base->ComplementDeLaBase                = (int *) MemAlloc( Probleme.NbVarDeBaseComplementaires * sizeof( int ) );
+	Base->NbVarDeBaseComplementairesAlloues = Probleme.NbVarDeBaseComplementaires;
+}
+Base->NbVarDeBaseComplementaires = Probleme.NbVarDeBaseComplementaires;
+memcpy( Base->ComplementDeLaBase, ProblemeAResoudre->ComplementDeLaBase, Base->NbVarDeBaseComplementaires * sizeof( int ) );
+}
+
+
+
 
 
 bool OPT_AppelDuSolveurLineaire( PROBLEME_HEBDO * ProblemeHebdo, uint numSpace, int NumIntervalle )
@@ -101,7 +177,7 @@ bool OPT_AppelDuSimplexe( PROBLEME_HEBDO * ProblemeHebdo, uint numSpace, int Num
 {
 int Var; int Cnt; double * pt; int il; int ilMax; int Classe; char PremierPassage;
 double CoutOpt; PROBLEME_ANTARES_A_RESOUDRE * ProblemeAResoudre; PROBLEME_SIMPLEXE Probleme;
-PROBLEME_SPX * ProbSpx;
+PROBLEME_SPX * ProbSpx; PROBLEMES_SIMPLEXE * ProblemesSpx; BASE_SIMPLEXE ** BaseDeLAnneePrecedente;
 
 
 
@@ -113,7 +189,10 @@ ProblemeAResoudre = ProblemeHebdo->ProblemeAResoudre;
 PremierPassage = OUI_ANTARES;
 
 Classe = ProblemeAResoudre->NumeroDeClasseDeManoeuvrabiliteActiveEnCours;
-ProbSpx = (PROBLEME_SPX *) ((ProblemeAResoudre->ProblemesSpxDUneClasseDeManoeuvrabilite[Classe])->ProblemeSpx[(int) NumIntervalle]);
+ProblemesSpx = ProblemeAResoudre->ProblemesSpxDUneClasseDeManoeuvrabilite[Classe];
+ProbSpx = (PROBLEME_SPX *) (ProblemesSpx->ProblemeSpx[(int) NumIntervalle]);
+
+BaseDeLAnneePrecedente = OPT_EmplacementDeLaBaseDeLAnneePrecedente( ProblemeAResoudre, ProblemesSpx, numSpace, NumIntervalle );
 
 RESOLUTION:
 
@@ -179,11 +258,18 @@ Probleme.PositionDeLaVariable       = ProblemeAResoudre->PositionDeLaVariable;
 Probleme.NbVarDeBaseComplementaires = 0; 
 Probleme.ComplementDeLaBase         = ProblemeAResoudre->ComplementDeLaBase;
 
+/* Apres un echec, on ne repart pas de la base de l'annee precedente (demarrage a froid) */
+if ( PremierPassage == OUI_ANTARES && BaseDeLAnneePrecedente != NULL ) {
+	if ( OPT_RestaurerLaBase( ProblemeAResoudre, *BaseDeLAnneePrecedente, Probleme ) ) Probleme.BaseDeDepartFournie = OUI_SPX;
+}
+
 Probleme.LibererMemoireALaFin = NON_SPX;
 
 Probleme.UtiliserCoutMax = NON_SPX;
 Probleme.CoutMax = 0.0;
 
+Probleme.NombreDeThreadsDePricing = ProblemeHebdo->NombreDeThreadsDePricing;
+
 Probleme.CoutsMarginauxDesContraintes = ProblemeAResoudre->CoutsMarginauxDesContraintes;
 Probleme.CoutsReduits                 = ProblemeAResoudre->CoutsReduits;
 
@@ -231,6 +317,8 @@ if ( ProblemeAResoudre->ExistenceDUneSolution != OUI_SPX && PremierPassage == OU
 }
 
 if ( ProblemeAResoudre->ExistenceDUneSolution == OUI_SPX ) {
+  if ( BaseDeLAnneePrecedente != NULL ) OPT_SauvegarderLaBase( ProblemeAResoudre, BaseDeLAnneePrecedente, Probleme );
+
   CoutOpt = 0.0;
 	
 	for ( Var = 0 ; Var < ProblemeAResoudre->NombreDeVariables ; Var++ ) {
@@ -307,7 +395,7 @@ return true;
 bool OPT_AppelDuSolveurPne( PROBLEME_HEBDO * ProblemeHebdo, uint numSpace, int NumIntervalle )
 {
 int Var; int Cnt; double * pt; int il; int ilMax; double CoutOpt; PROBLEME_ANTARES_A_RESOUDRE * ProblemeAResoudre;
-int * TypeEntierOuReel; PROBLEME_A_RESOUDRE ProblemePourPne; double u;
+int * TypeEntierOuReel; PROBLEME_A_RESOUDRE ProblemePourPne; double u; SEQUENCE_DE_PRESOLVE * Sequence;
 
 ProblemeAResoudre = ProblemeHebdo->ProblemeAResoudre;
 
@@ -341,6 +429,11 @@ if ( ProblemeAResoudre->NumeroDOptimisation == DEUXIEME_OPTIMISATION ) {
 
 }
 
+/* On rejoue les reductions du presolve enregistrees lors de la premiere semaine */
+Sequence = (SEQUENCE_DE_PRESOLVE *) ProblemeAResoudre->SequenceDePresolve;
+ProblemePourPne.SequenceDePresolve = NULL;
+if ( ProblemePourPne.FaireDuPresolve == OUI_PNE ) ProblemePourPne.SequenceDePresolve = Sequence;
+
 
 
 ProblemePourPne.TempsDExecutionMaximum       = 0;  
@@ -355,6 +448,14 @@ ProblemePourPne.ToleranceDOptimalite         = 1.e-4;
 
 PNE_Solveur( &ProblemePourPne );
 
+if ( ProblemePourPne.SequenceDePresolve != NULL ) {
+  if ( Sequence->Rejouee == OUI_PNE && ProblemePourPne.ExistenceDUneSolution != SOLUTION_OPTIMALE_TROUVEE ) {
+    /* Par securite, on refait un presolve complet qui enregistre une nouvelle sequence */
+    Sequence->Enregistree = NON_PNE;
+    PNE_Solveur( &ProblemePourPne );
+  }
+}
+
 if ( ProblemeHebdo->ExportMPS == OUI_ANTARES) OPT_EcrireJeuDeDonneesLineaireAuFormatMPS( (void *) &ProblemePourPne, numSpace, ANTARES_PNE );
 
 ProblemeAResoudre->ExistenceDUneSolution = ProblemePourPne.ExistenceDUneSolution;
@@ -560,6 +560,8 @@ if ( ProblemeHebdo->SolveurDuProblemeLineaire == ANTARES_SIMPLEXE ) {
   Probleme.UtiliserCoutMax = NON_SPX;
   Probleme.CoutMax = 0.0;
 
+  Probleme.NombreDeThreadsDePricing = 1;
+
   Probleme.CoutsMarginauxDesContraintes = NULL;
   Probleme.CoutsReduits                 = NULL;
 
@@ -606,6 +608,7 @@ else {
   ProblemePourPne.CoupesLiftAndProject       = NON_PNE; 
   ProblemePourPne.AffichageDesTraces = NON_PNE;
   ProblemePourPne.FaireDuPresolve = OUI_PNE ;               
+  ProblemePourPne.SequenceDePresolve = NULL;
   if ( ProblemePourPne.FaireDuPresolve == NON_PNE ) printf("!!!!!!!!!!!!!!  Attention pas de presolve dans les problemes auxiliaires   !!!!!!!!!\n");
   ProblemePourPne.TempsDExecutionMaximum       = 0;  
   ProblemePourPne.NombreMaxDeSolutionsEntieres = -1;   
@@ -85,11 +85,15 @@ OPT_GenererLesDonneesSelonLePasDeTempsDeLaClasseDeManoeuvrabilite( ProblemeHebdo
 
 
 
-OPT_ConstruireLaListeDesVariablesOptimiseesDuProblemeLineaire( ProblemeHebdo );
 
+if ( (ProblemeHebdo->ProblemeAResoudre)->ClasseDeManoeuvrabiliteDeLaStructureConstruite != (int) ClasseDeManoeuvrabilite ) {
+	
+	OPT_ConstruireLaListeDesVariablesOptimiseesDuProblemeLineaire( ProblemeHebdo );
 
+	OPT_ConstruireLaMatriceDesContraintesDuProblemeLineaire( ProblemeHebdo, numSpace );
 
-OPT_ConstruireLaMatriceDesContraintesDuProblemeLineaire( ProblemeHebdo, numSpace );
+	(ProblemeHebdo->ProblemeAResoudre)->ClasseDeManoeuvrabiliteDeLaStructureConstruite = (int) ClasseDeManoeuvrabilite;
+}
 
 OptimisationHebdo:
 
@@ -59,6 +59,9 @@ if ( ProblemeHebdo->LeProblemeADejaEteInstancie == NON_ANTARES ) {
 	
 	OPT_ConstruireLaMatriceDesContraintesDuProblemeQuadratique( ProblemeHebdo );
 
+	
+	(ProblemeHebdo->ProblemeAResoudre)->ClasseDeManoeuvrabiliteDeLaStructureConstruite = -1;
+
 	ProblemeHebdo->LeProblemeADejaEteInstancie = OUI_ANTARES;
 }
 
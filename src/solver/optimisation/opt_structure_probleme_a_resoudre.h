@@ -62,9 +62,24 @@
 
 /*--------------------------------------------------------------------------------------*/
 
+/* Base optimale d'un probleme simplexe */
+typedef struct {
+  int    NombreDeVariables;
+  int    NombreDeContraintes;
+  char * PositionDeLaVariable;
+  int    NbVarDeBaseComplementaires;
+  int    NbVarDeBaseComplementairesAlloues;
+  int  * ComplementDeLaBase;
+} BASE_SIMPLEXE;
+
 /* Les problemes Simplexe */
 typedef struct {
   void ** ProblemeSpx; /* Pour chaque classe de manoeuvrabilite, plusieurs problemes simplexe: 1 par jour */
+  int     NombreDIntervalles;
+  /* Pour chaque semaine et chaque intervalle, la base optimale de la premiere optimisation obtenue
+     l'annee precedente. NULL si on ne repart pas de la base de l'annee precedente */
+  BASE_SIMPLEXE ** BasesDeLAnneePrecedente;
+  int              NombreDeBases;
 } PROBLEMES_SIMPLEXE;
 
 /* Le probleme a resoudre */
@@ -74,6 +89,10 @@ typedef struct {
   char *   PremiereResolutionDuNumeroDeClasseDeManoeuvrabilite; /* OUI_SIM ou NON_SIM */
   /* Numero de la classe de manoeuvrabilite active en cours */
   int     NumeroDeClasseDeManoeuvrabiliteActiveEnCours;
+  /* Classe de manoeuvrabilite pour laquelle la liste des variables et la matrice des contraintes
+     du probleme lineaire ont ete construites (-1 si elles ne l'ont pas encore ete). Elles ne dependent
+     que de la topologie de l'etude: on ne les reconstruit donc pas d'une semaine a l'autre */
+  int     ClasseDeManoeuvrabiliteDeLaStructureConstruite;
   /* Pour la prise en compte des PMIN */
   char     NumeroDOptimisation; /* Vaut	PREMIERE_OPTIMISATION ou DEUXIEME_OPTIMISATION */
   /* La matrice des contraintes */
@@ -140,6 +159,10 @@ typedef struct {
 	/* Vecteurs de travail pour contruire la matrice des contraintes lineaires */
 	double * Pi;
 	int   * Colonne;
+
+  /* Sequence de presolve du solveur PNE (SEQUENCE_DE_PRESOLVE) enregistree lors de la premiere
+     optimisation et rejouee les semaines suivantes. NULL si on fait un presolve complet a chaque fois */
+  void * SequenceDePresolve;
 	
 } PROBLEME_ANTARES_A_RESOUDRE;
 
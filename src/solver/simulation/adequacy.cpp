@@ -343,7 +343,7 @@ namespace Simulation
 		{
 			CallbackBalanceRetrieval callback;
 			callback.bind(this, &Adequacy::callbackRetrieveBalanceData);
-			PerformQuadraticOptimisation(study, *pProblemesHebdo[0], callback, pNbWeeks);
+			PerformQuadraticOptimisation(study, pProblemesHebdo, pNbMaxPerformedYearsInParallel, callback, pNbWeeks);
 		}
 	}
 
@@ -33,8 +33,11 @@
 #include "common-eco-adq.h"
 #include <antares/logs.h>
 #include <cassert>
+#include <vector>
 #include "simulation.h"
 #include "../aleatoire/alea_fonctions.h"
+#include <yuni/job/job.h>
+#include <yuni/job/queue/service.h>
 
 
 using namespace Yuni;
@@ -48,7 +51,8 @@ namespace Simulation
 {
 
 
-	static void RecalculDesEchangesMoyens(Data::Study& study, PROBLEME_HEBDO& problem,
+	//! \return False if the quadratic optimisation of the week has failed
+	static bool RecalculDesEchangesMoyens(Data::Study& study, PROBLEME_HEBDO& problem, uint numSpace,
 		CallbackBalanceRetrieval& callback, int PasDeTempsDebut)
 	{
 		
@@ -80,16 +84,12 @@ namespace Simulation
 				ntcValues.ResistanceApparente[j]             = mtx[Data::fhlImpedances][decalPasDeTemps];
 				ntcValues.ValeurDeNTCOrigineVersExtremite[j] = mtx[Data::fhlNTCDirect][decalPasDeTemps];
 				ntcValues.ValeurDeNTCExtremiteVersOrigine[j] = mtx[Data::fhlNTCIndirect][decalPasDeTemps];
-				mtx.flush();
+				// The matrices of the links are flushed once all the weeks are done
+				// (see PerformQuadraticOptimisation()), they may be read by other jobs
 			}
 		}
 
-		if (not OPT_OptimisationHebdomadaire(&problem, 0))
-		{
-			
-			
-			study.runtime->quadraticOptimizationHasFailed = true;
-		}
+		bool success = OPT_OptimisationHebdomadaire(&problem, numSpace);
 
 		for (uint i = 0; i < (uint) problem.NombreDePasDeTemps; ++i)
 		{
@@ -102,9 +102,59 @@ namespace Simulation
 				ResultatsParInterconnexion[j]->TransitMoyenRecalculQuadratique[indx] = ntcValues.ValeurDuFlux[j];
 			}
 		}
+		return success;
 	}
 
 
+	/*!
+	** \brief Quadratic optimisation of a subset of weeks, on a dedicated weekly problem
+	**
+	** The weeks are independent from each other : they only read the average
+	** balances and write their own hours of TransitMoyenRecalculQuadratique.
+	** The job handles the weeks firstWeek, firstWeek + step, ... and only writes
+	** its own flag `failed` (reduced once all the jobs are done).
+	*/
+	class QuadraticWeeksJob final : public Yuni::Job::IJob
+	{
+	public:
+		QuadraticWeeksJob(Data::Study& pStudy, PROBLEME_HEBDO& pProblem, uint pNumSpace,
+			CallbackBalanceRetrieval& pCallback, uint pStartTime, uint pFirstWeek, uint pStep,
+			uint pNbWeeks, char& pFailed) :
+			study(pStudy),
+			problem(pProblem),
+			numSpace(pNumSpace),
+			callback(pCallback),
+			startTime(pStartTime),
+			firstWeek(pFirstWeek),
+			step(pStep),
+			nbWeeks(pNbWeeks),
+			failed(pFailed)
+		{}
+
+	private:
+		virtual void onExecute() override
+		{
+			for (uint w = firstWeek; w < nbWeeks; w += step)
+			{
+				int PasDeTempsDebut = startTime + (w * problem.NombreDePasDeTemps);
+				if (not RecalculDesEchangesMoyens(study, problem, numSpace, callback, PasDeTempsDebut))
+					failed = 1;
+			}
+		}
+
+	private:
+		Data::Study& study;
+		PROBLEME_HEBDO& problem;
+		uint numSpace;
+		CallbackBalanceRetrieval& callback;
+		uint startTime;
+		uint firstWeek;
+		uint step;
+		uint nbWeeks;
+		char& failed;
+	};
+
+
 
 
 
@@ -219,21 +269,76 @@ namespace Simulation
 	}
 
 
-	void PerformQuadraticOptimisation(Data::Study& study, PROBLEME_HEBDO& problem, CallbackBalanceRetrieval& callback, uint nbWeeks)
+	void PerformQuadraticOptimisation(Data::Study& study, PROBLEME_HEBDO** problems, uint nbProblems,
+		CallbackBalanceRetrieval& callback, uint nbWeeks)
 	{
+		assert(problems && nbProblems > 0);
+		auto& problem = *(problems[0]);
 		uint startTime = study.calendar.days[study.parameters.simulationDays.first].hours.first;
 
 		if (ShouldUseQuadraticOptimisation(study))
 		{
 			logs.info() << "Post-processing... (quadratic optimisation)";
 
-			problem.TypeDOptimisation           = OPTIMISATION_QUADRATIQUE;
-			problem.LeProblemeADejaEteInstancie = NON_ANTARES;
-			for (uint w = 0; w != nbWeeks; ++w)
+			// Only the spaces which have simulated at least one year hold an allocated
+			// problem to optimise (see OPT_PilotageOptimisationLineaire). The other ones
+			// (years filter, idle spaces) are left aside.
+			std::vector<uint> spaces;
+			spaces.reserve(nbProblems);
+			for (uint numSpace = 0; numSpace < nbProblems; ++numSpace)
 			{
-				int PasDeTempsDebut = startTime + (w * problem.NombreDePasDeTemps);
-				RecalculDesEchangesMoyens(study, problem, callback, PasDeTempsDebut);
+				if (problems[numSpace]->ProblemeAResoudre)
+					spaces.push_back(numSpace);
 			}
+			if (spaces.empty())
+				spaces.push_back(0);
+
+			// No need for more problems than weeks
+			if (spaces.size() > nbWeeks)
+				spaces.resize(nbWeeks);
+			const uint nbSpaces = (uint) spaces.size();
+
+			for (uint s = 0; s < nbSpaces; ++s)
+			{
+				problems[spaces[s]]->TypeDOptimisation           = OPTIMISATION_QUADRATIQUE;
+				problems[spaces[s]]->LeProblemeADejaEteInstancie = NON_ANTARES;
+			}
+
+			// One flag per job, no concurrent writes on the study
+			std::vector<char> failed(nbSpaces, 0);
+			if (nbSpaces <= 1)
+			{
+				auto& first = *(problems[spaces[0]]);
+				for (uint w = 0; w != nbWeeks; ++w)
+				{
+					int PasDeTempsDebut = startTime + (w * first.NombreDePasDeTemps);
+					if (not RecalculDesEchangesMoyens(study, first, spaces[0], callback, PasDeTempsDebut))
+						failed[0] = 1;
+				}
+			}
+			else
+			{
+				// One job per weekly problem, each one handling every nbSpaces-th week
+				Yuni::Job::QueueService qs;
+				qs.maximumThreadCount(nbSpaces);
+				qs.start();
+				for (uint s = 0; s < nbSpaces; ++s)
+				{
+					qs.add(new QuadraticWeeksJob(study, *(problems[spaces[s]]), spaces[s], callback,
+						startTime, s, nbSpaces, nbWeeks, failed[s]));
+				}
+				qs.wait(Yuni::qseIdle);
+				qs.stop();
+			}
+
+			for (uint s = 0; s < nbSpaces; ++s)
+			{
+				if (failed[s])
+					study.runtime->quadraticOptimizationHasFailed = true;
+			}
+
+			for (uint j = 0; j < study.runtime->interconnectionsCount; ++j)
+				study.runtime->areaLink[j]->data.flush();
 		}
 		else
 		{
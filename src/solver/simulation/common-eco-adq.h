@@ -86,8 +86,13 @@ namespace Simulation
 
 	/*!
 	** \brief Perform the quadratic optimization (links) (eco+adq)
+	**
+	** The weeks are independent and are dispatched over the given weekly
+	** problems (one thread per problem).
+	** \param problems The weekly problems, one per parallel year space
+	** \param nbProblems The number of weekly problems
 	*/
-	void PerformQuadraticOptimisation(Data::Study& study, PROBLEME_HEBDO& problem,
+	void PerformQuadraticOptimisation(Data::Study& study, PROBLEME_HEBDO** problems, unsigned int nbProblems,
 		CallbackBalanceRetrieval& callback, unsigned int nbWeeks);
 
 
@@ -221,7 +221,7 @@ namespace Simulation
 		{
 			CallbackBalanceRetrieval callback;
 			callback.bind(this, &Economy::callbackRetrieveBalanceData);
-			PerformQuadraticOptimisation(study, *pProblemesHebdo[0], callback, pNbWeeks);
+			PerformQuadraticOptimisation(study, pProblemesHebdo, pNbMaxPerformedYearsInParallel, callback, pNbWeeks);
 		}
 	}
 
@@ -38,6 +38,48 @@
 using namespace Antares;
 
 
+size_t SIM_TailleArenaProblemeHebdo(const Data::AreaList& areas, uint linkCount,
+	uint thermalPlantTotalCount, uint bindingConstraintCount, int NombreDePasDeTemps)
+{
+	typedef PROBLEME_HEBDO::Arena Arena;
+
+	uint nbPays = areas.size();
+	size_t taille = 0;
+
+	/* Donnees par pas de temps (un bloc contigu par pas de temps) */
+	taille += 8 * Arena::Taille<void *>(NombreDePasDeTemps);
+
+	size_t tailleParPasDeTemps = 0;
+	tailleParPasDeTemps += 2 * (Arena::Taille<VALEURS_DE_NTC_ET_RESISTANCES>(1) + 4 * Arena::Taille<double>(linkCount));
+	tailleParPasDeTemps += 2 * (Arena::Taille<CONSOMMATIONS_ABATTUES>(1) + Arena::Taille<double>(nbPays));
+	tailleParPasDeTemps += Arena::Taille<SOLDE_MOYEN_DES_ECHANGES>(1) + Arena::Taille<double>(nbPays);
+	tailleParPasDeTemps += Arena::Taille<CORRESPONDANCES_DES_VARIABLES>(1)
+		+ 3 * Arena::Taille<int>(linkCount) + 9 * Arena::Taille<int>(nbPays) + 5 * Arena::Taille<int>(thermalPlantTotalCount);
+	tailleParPasDeTemps += Arena::Taille<CORRESPONDANCES_DES_CONTRAINTES>(1)
+		+ 4 * Arena::Taille<int>(nbPays) + Arena::Taille<int>(linkCount) + Arena::Taille<int>(bindingConstraintCount)
+		+ 3 * Arena::Taille<int>(thermalPlantTotalCount);
+	tailleParPasDeTemps += Arena::Taille<VARIABLES_DUALES_INTERCONNEXIONS>(1) + Arena::Taille<double>(linkCount);
+	taille += NombreDePasDeTemps * tailleParPasDeTemps;
+
+	/* Paliers thermiques et resultats horaires (un bloc contigu par pays) */
+	taille += 2 * Arena::Taille<void *>(nbPays);
+	for (uint k = 0; k != nbPays; ++k)
+	{
+		const uint nbPaliers = areas.byIndex[k]->thermal.list.size();
+
+		taille += Arena::Taille<PALIERS_THERMIQUES>(1) + Arena::Taille<CLASSE_DE_MANOEUVRABILITE>(nbPaliers)
+			+ 9 * Arena::Taille<double>(nbPaliers) + 3 * Arena::Taille<int>(nbPaliers) + Arena::Taille<void *>(nbPaliers);
+		taille += nbPaliers * (Arena::Taille<PDISP_ET_COUTS_HORAIRES_PAR_PALIER>(1)
+			+ 7 * Arena::Taille<double>(NombreDePasDeTemps) + 2 * Arena::Taille<int>(NombreDePasDeTemps));
+
+		taille += Arena::Taille<RESULTATS_HORAIRES>(1) + 5 * Arena::Taille<double>(NombreDePasDeTemps)
+			+ Arena::Taille<void *>(NombreDePasDeTemps);
+		taille += NombreDePasDeTemps * (Arena::Taille<PRODUCTION_THERMIQUE_OPTIMALE>(1) + 5 * Arena::Taille<double>(nbPaliers));
+	}
+	return taille;
+}
+
+
 void SIM_AllocationProblemeHebdo(PROBLEME_HEBDO& problem, int NombreDePasDeTemps)
 {
 	int k; int  j;
@@ -51,6 +93,11 @@ void SIM_AllocationProblemeHebdo(PROBLEME_HEBDO& problem, int NombreDePasDeTemps
 
 	problem.manoeuvrabilite.reserve(nbPays, linkCount);
 
+	auto& arena = problem.arena;
+	const size_t tailleArena = SIM_TailleArenaProblemeHebdo(study.areas, linkCount,
+		study.runtime->thermalPlantTotalCount, study.runtime->bindingConstraintCount, NombreDePasDeTemps);
+	arena.reserve(tailleArena);
+
 	
 	problem.DefaillanceNegativeUtiliserPMinThermique = (char*) MemAlloc(nbPays * sizeof(char));
 	problem.DefaillanceNegativeUtiliserHydro         = (char*) MemAlloc(nbPays * sizeof(char));
@@ -80,16 +127,16 @@ void SIM_AllocationProblemeHebdo(PROBLEME_HEBDO& problem, int NombreDePasDeTemps
 	problem.CoutDeDefaillanceEnReserve              = (double *)              MemAlloc( nbPays * sizeof(double) );
 	problem.NumeroDeContrainteEnergieHydraulique    = (int *)                 MemAlloc( nbPays * sizeof(int) );
 	problem.NumeroDeContrainteDeSoldeDEchange       = (int *)                 MemAlloc( nbPays * sizeof(int) );
-	problem.ValeursDeNTC                            = (VALEURS_DE_NTC_ET_RESISTANCES **)           MemAlloc( NombreDePasDeTemps * sizeof(void *) );
-	problem.ValeursDeNTCRef                         = (VALEURS_DE_NTC_ET_RESISTANCES **)           MemAlloc( NombreDePasDeTemps * sizeof(void *) );
-	problem.ConsommationsAbattues                   = (CONSOMMATIONS_ABATTUES **)                  MemAlloc( NombreDePasDeTemps * sizeof(void *) );
-	problem.ConsommationsAbattuesRef                = (CONSOMMATIONS_ABATTUES **)                  MemAlloc( NombreDePasDeTemps * sizeof(void *) );
-	problem.SoldeMoyenHoraire                       = (SOLDE_MOYEN_DES_ECHANGES **)                MemAlloc( NombreDePasDeTemps * sizeof(void *) );
-	problem.CorrespondanceVarNativesVarOptim        = (CORRESPONDANCES_DES_VARIABLES **)           MemAlloc( NombreDePasDeTemps * sizeof(void *) );
-	problem.CorrespondanceCntNativesCntOptim        = (CORRESPONDANCES_DES_CONTRAINTES **)         MemAlloc( NombreDePasDeTemps * sizeof(void *) );
-	problem.VariablesDualesDesContraintesDeNTC      = (VARIABLES_DUALES_INTERCONNEXIONS **)        MemAlloc( NombreDePasDeTemps * sizeof(void *) );
+	problem.ValeursDeNTC                            = arena.allocate<VALEURS_DE_NTC_ET_RESISTANCES *>( NombreDePasDeTemps );
+	problem.ValeursDeNTCRef                         = arena.allocate<VALEURS_DE_NTC_ET_RESISTANCES *>( NombreDePasDeTemps );
+	problem.ConsommationsAbattues                   = arena.allocate<CONSOMMATIONS_ABATTUES *>( NombreDePasDeTemps );
+	problem.ConsommationsAbattuesRef                = arena.allocate<CONSOMMATIONS_ABATTUES *>( NombreDePasDeTemps );
+	problem.SoldeMoyenHoraire                       = arena.allocate<SOLDE_MOYEN_DES_ECHANGES *>( NombreDePasDeTemps );
+	problem.CorrespondanceVarNativesVarOptim        = arena.allocate<CORRESPONDANCES_DES_VARIABLES *>( NombreDePasDeTemps );
+	problem.CorrespondanceCntNativesCntOptim        = arena.allocate<CORRESPONDANCES_DES_CONTRAINTES *>( NombreDePasDeTemps );
+	problem.VariablesDualesDesContraintesDeNTC      = arena.allocate<VARIABLES_DUALES_INTERCONNEXIONS *>( NombreDePasDeTemps );
 	problem.MatriceDesContraintesCouplantes         = (CONTRAINTES_COUPLANTES **)                  MemAlloc( study.runtime->bindingConstraintCount * sizeof(void *) );
-	problem.PaliersThermiquesDuPays                 = (PALIERS_THERMIQUES **)                      MemAlloc( nbPays * sizeof(void *) );
+	problem.PaliersThermiquesDuPays                 = arena.allocate<PALIERS_THERMIQUES *>( nbPays );
 	problem.CaracteristiquesHydrauliques            = (ENERGIES_ET_PUISSANCES_HYDRAULIQUES **)     MemAlloc( nbPays * sizeof(void *) );
 	
 
@@ -99,7 +146,7 @@ void SIM_AllocationProblemeHebdo(PROBLEME_HEBDO& problem, int NombreDePasDeTemps
 	problem.CoutsMarginauxDesContraintesDeReserveParZone = (COUTS_MARGINAUX_ZONES_DE_RESERVE **) MemAlloc( nbPays * sizeof( void * ) );
 	
 	problem.ReserveJMoins1    = (RESERVE_JMOINS1 **)    MemAlloc( nbPays * sizeof(void *) );
-	problem.ResultatsHoraires = (RESULTATS_HORAIRES **) MemAlloc( nbPays * sizeof(void *) );
+	problem.ResultatsHoraires = arena.allocate<RESULTATS_HORAIRES *>( nbPays );
 
 	
 	
@@ -111,64 +158,65 @@ void SIM_AllocationProblemeHebdo(PROBLEME_HEBDO& problem, int NombreDePasDeTemps
 
 	for (k = 0; k < NombreDePasDeTemps; k++)
 	{
-		problem.ValeursDeNTC[k]                            = (VALEURS_DE_NTC_ET_RESISTANCES *)           MemAlloc( sizeof(VALEURS_DE_NTC_ET_RESISTANCES) );
-		problem.ValeursDeNTCRef[k]                         = (VALEURS_DE_NTC_ET_RESISTANCES *)           MemAlloc( sizeof(VALEURS_DE_NTC_ET_RESISTANCES) );
-		problem.ConsommationsAbattues[k]                   = (CONSOMMATIONS_ABATTUES *)                  MemAlloc( sizeof(CONSOMMATIONS_ABATTUES) );
-		problem.ConsommationsAbattuesRef[k]                = (CONSOMMATIONS_ABATTUES *)                  MemAlloc( sizeof(CONSOMMATIONS_ABATTUES) );
-		problem.SoldeMoyenHoraire[k]                       = (SOLDE_MOYEN_DES_ECHANGES *)                MemAlloc( sizeof(SOLDE_MOYEN_DES_ECHANGES) );
-		problem.CorrespondanceVarNativesVarOptim[k]        = (CORRESPONDANCES_DES_VARIABLES *)           MemAlloc( sizeof(CORRESPONDANCES_DES_VARIABLES) );
-		problem.CorrespondanceCntNativesCntOptim[k]        = (CORRESPONDANCES_DES_CONTRAINTES *)         MemAlloc( sizeof(CORRESPONDANCES_DES_CONTRAINTES) );
-		problem.VariablesDualesDesContraintesDeNTC[k]      = (VARIABLES_DUALES_INTERCONNEXIONS *)        MemAlloc( sizeof(VARIABLES_DUALES_INTERCONNEXIONS) );
-		problem.ValeursDeNTC[k]->ResistanceApparente                      = (double *) MemAlloc( linkCount *  sizeof(double) );
-		problem.ValeursDeNTC[k]->ValeurDeNTCExtremiteVersOrigine          = (double *) MemAlloc( linkCount *  sizeof(double) );
-		problem.ValeursDeNTC[k]->ValeurDeNTCOrigineVersExtremite          = (double *) MemAlloc( linkCount *  sizeof(double) );
-		problem.ValeursDeNTC[k]->ValeurDuFlux                             = (double *) MemAlloc( linkCount *  sizeof(double) );
-		problem.ValeursDeNTCRef[k]->ResistanceApparente                   = (double *) MemAlloc( linkCount *  sizeof(double) );
-		problem.ValeursDeNTCRef[k]->ValeurDeNTCExtremiteVersOrigine       = (double *) MemAlloc( linkCount *  sizeof(double) );
-		problem.ValeursDeNTCRef[k]->ValeurDeNTCOrigineVersExtremite       = (double *) MemAlloc( linkCount *  sizeof(double) );
-		problem.ValeursDeNTCRef[k]->ValeurDuFlux                          = (double *) MemAlloc( linkCount *  sizeof(double) );
-		problem.ConsommationsAbattues[k]->ConsommationAbattueDuPays       = (double *) MemAlloc( nbPays *  sizeof(double) );
-		problem.ConsommationsAbattuesRef[k]->ConsommationAbattueDuPays    = (double *) MemAlloc( nbPays *  sizeof(double) );
-		problem.SoldeMoyenHoraire[k]->SoldeMoyenDuPays                    = (double *) MemAllocMemset( nbPays *                  sizeof(double) );
-
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDeLInterconnexion                         = (int *) MemAlloc( linkCount * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableCoutOrigineVersExtremiteDeLInterconnexion = (int *) MemAlloc( linkCount * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableCoutExtremiteVersOrigineDeLInterconnexion = (int *) MemAlloc( linkCount * sizeof(int) );
-
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuPalierThermique                              = (int *)   MemAlloc( study.runtime->thermalPlantTotalCount * sizeof(int));
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesDeLaProdHyd                                   = (int *)   MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillancePositive                            = (int *)   MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillanceNegative                            = (int *)   MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeGrosseVariableDefaillancePositive                      = (int *)   MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeGrosseVariableDefaillanceNegative                      = (int *)   MemAlloc( nbPays * sizeof(int) );
+		problem.ValeursDeNTC[k]                            = arena.allocate<VALEURS_DE_NTC_ET_RESISTANCES>( 1 );
+		problem.ValeursDeNTCRef[k]                         = arena.allocate<VALEURS_DE_NTC_ET_RESISTANCES>( 1 );
+		problem.ConsommationsAbattues[k]                   = arena.allocate<CONSOMMATIONS_ABATTUES>( 1 );
+		problem.ConsommationsAbattuesRef[k]                = arena.allocate<CONSOMMATIONS_ABATTUES>( 1 );
+		problem.SoldeMoyenHoraire[k]                       = arena.allocate<SOLDE_MOYEN_DES_ECHANGES>( 1 );
+		problem.CorrespondanceVarNativesVarOptim[k]        = arena.allocate<CORRESPONDANCES_DES_VARIABLES>( 1 );
+		problem.CorrespondanceCntNativesCntOptim[k]        = arena.allocate<CORRESPONDANCES_DES_CONTRAINTES>( 1 );
+		problem.VariablesDualesDesContraintesDeNTC[k]      = arena.allocate<VARIABLES_DUALES_INTERCONNEXIONS>( 1 );
+		problem.ValeursDeNTC[k]->ResistanceApparente                      = arena.allocate<double>( linkCount );
+		problem.ValeursDeNTC[k]->ValeurDeNTCExtremiteVersOrigine          = arena.allocate<double>( linkCount );
+		problem.ValeursDeNTC[k]->ValeurDeNTCOrigineVersExtremite          = arena.allocate<double>( linkCount );
+		problem.ValeursDeNTC[k]->ValeurDuFlux                             = arena.allocate<double>( linkCount );
+		problem.ValeursDeNTCRef[k]->ResistanceApparente                   = arena.allocate<double>( linkCount );
+		problem.ValeursDeNTCRef[k]->ValeurDeNTCExtremiteVersOrigine       = arena.allocate<double>( linkCount );
+		problem.ValeursDeNTCRef[k]->ValeurDeNTCOrigineVersExtremite       = arena.allocate<double>( linkCount );
+		problem.ValeursDeNTCRef[k]->ValeurDuFlux                          = arena.allocate<double>( linkCount );
+		problem.ConsommationsAbattues[k]->ConsommationAbattueDuPays       = arena.allocate<double>( nbPays );
+		problem.ConsommationsAbattuesRef[k]->ConsommationAbattueDuPays    = arena.allocate<double>( nbPays );
+		
+		problem.SoldeMoyenHoraire[k]->SoldeMoyenDuPays                    = arena.allocate<double>( nbPays );
+
+		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDeLInterconnexion                         = arena.allocate<int>( linkCount );
+		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableCoutOrigineVersExtremiteDeLInterconnexion = arena.allocate<int>( linkCount );
+		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableCoutExtremiteVersOrigineDeLInterconnexion = arena.allocate<int>( linkCount );
+
+		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuPalierThermique                              = arena.allocate<int>( study.runtime->thermalPlantTotalCount );
+		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesDeLaProdHyd                                   = arena.allocate<int>( nbPays );
+		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillancePositive                            = arena.allocate<int>( nbPays );
+		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillanceNegative                            = arena.allocate<int>( nbPays );
+		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeGrosseVariableDefaillancePositive                      = arena.allocate<int>( nbPays );
+		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeGrosseVariableDefaillanceNegative                      = arena.allocate<int>( nbPays );
 		
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillanceEnReserve                           = (int *)   MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeGrosseVariableDefaillanceEnReserve                     = (int *)   MemAlloc( nbPays * sizeof(int) );
+		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillanceEnReserve                           = arena.allocate<int>( nbPays );
+		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeGrosseVariableDefaillanceEnReserve                     = arena.allocate<int>( nbPays );
 		
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesVariationHydALaBaisse                         = (int *)   MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesVariationHydALaHausse                         = (int *)   MemAlloc( nbPays * sizeof(int) );
+		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesVariationHydALaBaisse                         = arena.allocate<int>( nbPays );
+		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesVariationHydALaHausse                         = arena.allocate<int>( nbPays );
 		
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuNombreDeGroupesEnMarcheDuPalierThermique     = (int *)   MemAlloc( study.runtime->thermalPlantTotalCount * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuNombreDeGroupesQuiDemarrentDuPalierThermique = (int *)   MemAlloc( study.runtime->thermalPlantTotalCount * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuNombreDeGroupesQuiSArretentDuPalierThermique = (int *)   MemAlloc( study.runtime->thermalPlantTotalCount * sizeof(int) );
-		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuNombreDeGroupesQuiTombentEnPanneDuPalierThermique = (int *)   MemAlloc( study.runtime->thermalPlantTotalCount * sizeof(int) );
+		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuNombreDeGroupesEnMarcheDuPalierThermique     = arena.allocate<int>( study.runtime->thermalPlantTotalCount );
+		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuNombreDeGroupesQuiDemarrentDuPalierThermique = arena.allocate<int>( study.runtime->thermalPlantTotalCount );
+		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuNombreDeGroupesQuiSArretentDuPalierThermique = arena.allocate<int>( study.runtime->thermalPlantTotalCount );
+		problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuNombreDeGroupesQuiTombentEnPanneDuPalierThermique = arena.allocate<int>( study.runtime->thermalPlantTotalCount );
 
-		problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDesBilansPays                = (int *)   MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContraintePourEviterLesChargesFictives = (int *)   MemAlloc( nbPays * sizeof(int) );
+		problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDesBilansPays                = arena.allocate<int>( nbPays );
+		problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContraintePourEviterLesChargesFictives = arena.allocate<int>( nbPays );
 
 		
 
 
-		problem.CorrespondanceCntNativesCntOptim[k]->NumeroPremiereContrainteDeReserveParZone         = (int *)   MemAlloc( nbPays * sizeof(int) );
-		problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeuxiemeContrainteDeReserveParZone         = (int *)   MemAlloc( nbPays * sizeof(int) );		
-		problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDeDissociationDeFlux           = (int *)   MemAlloc( linkCount * sizeof(int) );
-		problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDesContraintesCouplantes       = (int *)   MemAlloc( study.runtime->bindingConstraintCount * sizeof(int) );
+		problem.CorrespondanceCntNativesCntOptim[k]->NumeroPremiereContrainteDeReserveParZone         = arena.allocate<int>( nbPays );
+		problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeuxiemeContrainteDeReserveParZone         = arena.allocate<int>( nbPays );		
+		problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDeDissociationDeFlux           = arena.allocate<int>( linkCount );
+		problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDesContraintesCouplantes       = arena.allocate<int>( study.runtime->bindingConstraintCount );
 
-    problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDesContraintesDeDureeMinDeMarche = (int *)   MemAlloc( study.runtime->thermalPlantTotalCount * sizeof(int) );
-    problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDesContraintesDeDureeMinDArret   = (int *)   MemAlloc( study.runtime->thermalPlantTotalCount * sizeof(int) );
-    problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeLaDeuxiemeContrainteDesContraintesDesGroupesQuiTombentEnPanne = (int *) MemAlloc( study.runtime->thermalPlantTotalCount * sizeof(int) );
+    problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDesContraintesDeDureeMinDeMarche = arena.allocate<int>( study.runtime->thermalPlantTotalCount );
+    problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDesContraintesDeDureeMinDArret   = arena.allocate<int>( study.runtime->thermalPlantTotalCount );
+    problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeLaDeuxiemeContrainteDesContraintesDesGroupesQuiTombentEnPanne = arena.allocate<int>( study.runtime->thermalPlantTotalCount );
 		
-		problem.VariablesDualesDesContraintesDeNTC[k]->VariableDualeParInterconnexion                 = (double *) MemAlloc( linkCount *        sizeof(double) );
+		problem.VariablesDualesDesContraintesDeNTC[k]->VariableDualeParInterconnexion                 = arena.allocate<double>( linkCount );
 	}
 
 	for (k = 0 ; k < (int) linkCount ; ++k) {
@@ -225,7 +273,7 @@ void SIM_AllocationProblemeHebdo(PROBLEME_HEBDO& problem, int NombreDePasDeTemps
 		
 		const uint nbPaliers = (study.areas.byIndex[k])->thermal.list.size();
 
-		problem.PaliersThermiquesDuPays[k]      = (PALIERS_THERMIQUES *)                  MemAlloc( sizeof(PALIERS_THERMIQUES) );
+		problem.PaliersThermiquesDuPays[k]      = arena.allocate<PALIERS_THERMIQUES>( 1 );
 		problem.CaracteristiquesHydrauliques[k] = (ENERGIES_ET_PUISSANCES_HYDRAULIQUES *) MemAlloc( sizeof(ENERGIES_ET_PUISSANCES_HYDRAULIQUES) );
 		
 
@@ -236,22 +284,22 @@ void SIM_AllocationProblemeHebdo(PROBLEME_HEBDO& problem, int NombreDePasDeTemps
 	  problem.CoutsMarginauxDesContraintesDeReserveParZone[k]->CoutsMarginauxHorairesDeLaReserveParZone = (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
 		
 		problem.ReserveJMoins1[k]               = (RESERVE_JMOINS1 *)                     MemAlloc( sizeof(RESERVE_JMOINS1) );
-		problem.ResultatsHoraires[k]            = (RESULTATS_HORAIRES *)                  MemAlloc( sizeof(RESULTATS_HORAIRES) );
-
-		problem.PaliersThermiquesDuPays[k]->ClasseDeManoeuvrabilite                         = (CLASSE_DE_MANOEUVRABILITE *) MemAlloc( nbPaliers * sizeof(CLASSE_DE_MANOEUVRABILITE) );
-		problem.PaliersThermiquesDuPays[k]->PminDuPalierThermiquePendantUneHeure            = (double *) MemAlloc( nbPaliers * sizeof(double));
-		problem.PaliersThermiquesDuPays[k]->PminDuPalierThermiquePendantUneSemaine          = (double *) MemAlloc( nbPaliers * sizeof(double));
-		problem.PaliersThermiquesDuPays[k]->PminDuPalierThermiquePendantUnJour              = (double *) MemAlloc( nbPaliers * sizeof(double));
-		problem.PaliersThermiquesDuPays[k]->TailleUnitaireDUnGroupeDuPalierThermique        = (double *) MemAlloc( nbPaliers * sizeof(double));
-		problem.PaliersThermiquesDuPays[k]->NumeroDuPalierDansLEnsembleDesPaliersThermiques = (int *)    MemAlloc( nbPaliers * sizeof(int) );
+		problem.ResultatsHoraires[k]            = arena.allocate<RESULTATS_HORAIRES>( 1 );
+
+		problem.PaliersThermiquesDuPays[k]->ClasseDeManoeuvrabilite                         = arena.allocate<CLASSE_DE_MANOEUVRABILITE>( nbPaliers );
+		problem.PaliersThermiquesDuPays[k]->PminDuPalierThermiquePendantUneHeure            = arena.allocate<double>( nbPaliers );
+		problem.PaliersThermiquesDuPays[k]->PminDuPalierThermiquePendantUneSemaine          = arena.allocate<double>( nbPaliers );
+		problem.PaliersThermiquesDuPays[k]->PminDuPalierThermiquePendantUnJour              = arena.allocate<double>( nbPaliers );
+		problem.PaliersThermiquesDuPays[k]->TailleUnitaireDUnGroupeDuPalierThermique        = arena.allocate<double>( nbPaliers );
+		problem.PaliersThermiquesDuPays[k]->NumeroDuPalierDansLEnsembleDesPaliersThermiques = arena.allocate<int>( nbPaliers );
     
-		problem.PaliersThermiquesDuPays[k]->CoutDeDemarrageDUnGroupeDuPalierThermique       = (double *) MemAlloc( nbPaliers * sizeof(double) );
-		problem.PaliersThermiquesDuPays[k]->CoutDArretDUnGroupeDuPalierThermique            = (double *) MemAlloc( nbPaliers * sizeof(double) );
-		problem.PaliersThermiquesDuPays[k]->CoutFixeDeMarcheDUnGroupeDuPalierThermique      = (double *) MemAlloc( nbPaliers * sizeof(double) );
-		problem.PaliersThermiquesDuPays[k]->PminDUnGroupeDuPalierThermique                  = (double *) MemAlloc( nbPaliers * sizeof(double) );
-		problem.PaliersThermiquesDuPays[k]->PmaxDUnGroupeDuPalierThermique                  = (double *) MemAlloc( nbPaliers * sizeof(double) );
-		problem.PaliersThermiquesDuPays[k]->DureeMinimaleDeMarcheDUnGroupeDuPalierThermique = (int *)    MemAlloc( nbPaliers * sizeof(int) );
-		problem.PaliersThermiquesDuPays[k]->DureeMinimaleDArretDUnGroupeDuPalierThermique   = (int *)    MemAlloc( nbPaliers * sizeof(int) );
+		problem.PaliersThermiquesDuPays[k]->CoutDeDemarrageDUnGroupeDuPalierThermique       = arena.allocate<double>( nbPaliers );
+		problem.PaliersThermiquesDuPays[k]->CoutDArretDUnGroupeDuPalierThermique            = arena.allocate<double>( nbPaliers );
+		problem.PaliersThermiquesDuPays[k]->CoutFixeDeMarcheDUnGroupeDuPalierThermique      = arena.allocate<double>( nbPaliers );
+		problem.PaliersThermiquesDuPays[k]->PminDUnGroupeDuPalierThermique                  = arena.allocate<double>( nbPaliers );
+		problem.PaliersThermiquesDuPays[k]->PmaxDUnGroupeDuPalierThermique                  = arena.allocate<double>( nbPaliers );
+		problem.PaliersThermiquesDuPays[k]->DureeMinimaleDeMarcheDUnGroupeDuPalierThermique = arena.allocate<int>( nbPaliers );
+		problem.PaliersThermiquesDuPays[k]->DureeMinimaleDArretDUnGroupeDuPalierThermique   = arena.allocate<int>( nbPaliers );
     		
 		problem.CaracteristiquesHydrauliques[k]->CntEnergieH2OParIntervalleOptimise      = (double *) MemAllocMemset( 7 * sizeof(double) );
 		problem.CaracteristiquesHydrauliques[k]->CntEnergieH2OParJour                    = (double *) MemAllocMemset( 7 * sizeof(double) );
@@ -264,40 +312,42 @@ void SIM_AllocationProblemeHebdo(PROBLEME_HEBDO& problem, int NombreDePasDeTemps
 
 		problem.ReserveJMoins1[k]->ReserveHoraireJMoins1                    = (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
 		problem.ReserveJMoins1[k]->ReserveHoraireJMoins1Ref                 = (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
-		problem.ResultatsHoraires[k]->ValeursHorairesDeDefaillancePositive  = (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
-		problem.ResultatsHoraires[k]->ValeursHorairesDeDefaillanceNegative  = (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
-		problem.ResultatsHoraires[k]->ValeursHorairesDeDefaillanceEnReserve = (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
-		problem.ResultatsHoraires[k]->TurbinageHoraire                      = (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
-		problem.ResultatsHoraires[k]->CoutsMarginauxHoraires                = (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
-		problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout       = (PDISP_ET_COUTS_HORAIRES_PAR_PALIER **) MemAlloc( nbPaliers *  sizeof(void *) );
-		problem.ResultatsHoraires[k]->ProductionThermique                   = (PRODUCTION_THERMIQUE_OPTIMALE **)      MemAlloc( NombreDePasDeTemps * sizeof(void *) );
+		problem.ResultatsHoraires[k]->ValeursHorairesDeDefaillancePositive  = arena.allocate<double>( NombreDePasDeTemps );
+		problem.ResultatsHoraires[k]->ValeursHorairesDeDefaillanceNegative  = arena.allocate<double>( NombreDePasDeTemps );
+		problem.ResultatsHoraires[k]->ValeursHorairesDeDefaillanceEnReserve = arena.allocate<double>( NombreDePasDeTemps );
+		problem.ResultatsHoraires[k]->TurbinageHoraire                      = arena.allocate<double>( NombreDePasDeTemps );
+		problem.ResultatsHoraires[k]->CoutsMarginauxHoraires                = arena.allocate<double>( NombreDePasDeTemps );
+		problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout       = arena.allocate<PDISP_ET_COUTS_HORAIRES_PAR_PALIER *>( nbPaliers );
+		problem.ResultatsHoraires[k]->ProductionThermique                   = arena.allocate<PRODUCTION_THERMIQUE_OPTIMALE *>( NombreDePasDeTemps );
 
 		for (j = 0; j < (int)nbPaliers; ++j)
 		{
-			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j] = (PDISP_ET_COUTS_HORAIRES_PAR_PALIER *) MemAlloc( sizeof(PDISP_ET_COUTS_HORAIRES_PAR_PALIER) );
-
-			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->CoutHoraireDeProductionDuPalierThermique    = (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
-			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->CoutHoraireDeProductionDuPalierThermiqueRef = (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
-			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->PuissanceDisponibleDuPalierThermique        = (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
-			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->PuissanceDisponibleDuPalierThermiqueRef     = (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
-			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->PuissanceDisponibleDuPalierThermiqueRef_SV  = (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
-			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->PuissanceMinDuPalierThermique               = (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
-			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->PuissanceMinDuPalierThermique_SV            = (double *) MemAlloc( NombreDePasDeTemps * sizeof(double) );
-			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->NombreMaxDeGroupesEnMarcheDuPalierThermique = (int *) MemAlloc( NombreDePasDeTemps * sizeof(int) );
-			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->NombreMinDeGroupesEnMarcheDuPalierThermique = (int *) MemAlloc( NombreDePasDeTemps * sizeof(int) );			
+			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j] = arena.allocate<PDISP_ET_COUTS_HORAIRES_PAR_PALIER>( 1 );
+
+			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->CoutHoraireDeProductionDuPalierThermique    = arena.allocate<double>( NombreDePasDeTemps );
+			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->CoutHoraireDeProductionDuPalierThermiqueRef = arena.allocate<double>( NombreDePasDeTemps );
+			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->PuissanceDisponibleDuPalierThermique        = arena.allocate<double>( NombreDePasDeTemps );
+			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->PuissanceDisponibleDuPalierThermiqueRef     = arena.allocate<double>( NombreDePasDeTemps );
+			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->PuissanceDisponibleDuPalierThermiqueRef_SV  = arena.allocate<double>( NombreDePasDeTemps );
+			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->PuissanceMinDuPalierThermique               = arena.allocate<double>( NombreDePasDeTemps );
+			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->PuissanceMinDuPalierThermique_SV            = arena.allocate<double>( NombreDePasDeTemps );
+			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->NombreMaxDeGroupesEnMarcheDuPalierThermique = arena.allocate<int>( NombreDePasDeTemps );
+			problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->NombreMinDeGroupesEnMarcheDuPalierThermique = arena.allocate<int>( NombreDePasDeTemps );			
 		}
 		for (j = 0; j < NombreDePasDeTemps; j++)
 		{
-			problem.ResultatsHoraires[k]->ProductionThermique[j] = (PRODUCTION_THERMIQUE_OPTIMALE *) MemAlloc(sizeof(PRODUCTION_THERMIQUE_OPTIMALE));
-			problem.ResultatsHoraires[k]->ProductionThermique[j]->ProductionThermiqueDuPalier = (double *) MemAlloc( nbPaliers * sizeof(double));
-			problem.ResultatsHoraires[k]->ProductionThermique[j]->NombreDeGroupesEnMarcheDuPalier = (double *) MemAlloc( nbPaliers * sizeof(double));
-			problem.ResultatsHoraires[k]->ProductionThermique[j]->NombreDeGroupesQuiDemarrentDuPalier = (double *) MemAlloc( nbPaliers * sizeof(double));
-			problem.ResultatsHoraires[k]->ProductionThermique[j]->NombreDeGroupesQuiSArretentDuPalier = (double *) MemAlloc( nbPaliers * sizeof(double));			
-			problem.ResultatsHoraires[k]->ProductionThermique[j]->NombreDeGroupesQuiTombentEnPanneDuPalier = (double *) MemAlloc( nbPaliers * sizeof(double));			
+			problem.ResultatsHoraires[k]->ProductionThermique[j] = arena.allocate<PRODUCTION_THERMIQUE_OPTIMALE>( 1 );
+			problem.ResultatsHoraires[k]->ProductionThermique[j]->ProductionThermiqueDuPalier = arena.allocate<double>( nbPaliers );
+			problem.ResultatsHoraires[k]->ProductionThermique[j]->NombreDeGroupesEnMarcheDuPalier = arena.allocate<double>( nbPaliers );
+			problem.ResultatsHoraires[k]->ProductionThermique[j]->NombreDeGroupesQuiDemarrentDuPalier = arena.allocate<double>( nbPaliers );
+			problem.ResultatsHoraires[k]->ProductionThermique[j]->NombreDeGroupesQuiSArretentDuPalier = arena.allocate<double>( nbPaliers );			
+			problem.ResultatsHoraires[k]->ProductionThermique[j]->NombreDeGroupesQuiTombentEnPanneDuPalier = arena.allocate<double>( nbPaliers );			
 		}
 	}
 
 	problem.CoutOptimalDeLaSolution = (double *) MemAlloc( 7 * sizeof(double) );
+
+	assert(arena.size() == tailleArena);
 }
 
 
@@ -322,66 +372,6 @@ void SIM_DesallocationProblemeHebdo( PROBLEME_HEBDO& problem )
 	MemFree( problem.NbGrpCourbeGuide );
 	MemFree( problem.NbGrpOpt );
 
-	for (int k = 0; k < problem.NombreDePasDeTemps; k++) {
-		MemFree( problem.ValeursDeNTC[k]->ResistanceApparente );
-		MemFree( problem.ValeursDeNTC[k]->ValeurDeNTCExtremiteVersOrigine );
-		MemFree( problem.ValeursDeNTC[k]->ValeurDeNTCOrigineVersExtremite );
-		MemFree( problem.ValeursDeNTC[k]->ValeurDuFlux );
-		MemFree( problem.ValeursDeNTC[k] );
-		MemFree( problem.ConsommationsAbattues[k]->ConsommationAbattueDuPays );
-		MemFree( problem.ConsommationsAbattues[k] );
-		MemFree( problem.ValeursDeNTCRef[k]->ResistanceApparente );
-		MemFree( problem.ValeursDeNTCRef[k]->ValeurDeNTCExtremiteVersOrigine );
-		MemFree( problem.ValeursDeNTCRef[k]->ValeurDeNTCOrigineVersExtremite );
-		MemFree( problem.ValeursDeNTCRef[k]->ValeurDuFlux );
-		MemFree( problem.ValeursDeNTCRef[k] );
-		MemFree( problem.ConsommationsAbattuesRef[k]->ConsommationAbattueDuPays );
-		MemFree( problem.ConsommationsAbattuesRef[k] );
-		MemFree( problem.SoldeMoyenHoraire[k]->SoldeMoyenDuPays );
-		MemFree( problem.SoldeMoyenHoraire[k] );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDeLInterconnexion );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableCoutOrigineVersExtremiteDeLInterconnexion );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableCoutExtremiteVersOrigineDeLInterconnexion );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuPalierThermique );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesDeLaProdHyd );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillancePositive );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillanceNegative );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeGrosseVariableDefaillancePositive );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeGrosseVariableDefaillanceNegative );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDefaillanceEnReserve );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeGrosseVariableDefaillanceEnReserve );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesVariationHydALaBaisse );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariablesVariationHydALaHausse );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuNombreDeGroupesEnMarcheDuPalierThermique );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuNombreDeGroupesQuiDemarrentDuPalierThermique );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuNombreDeGroupesQuiSArretentDuPalierThermique );
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k]->NumeroDeVariableDuNombreDeGroupesQuiTombentEnPanneDuPalierThermique );
-		
-		MemFree( problem.CorrespondanceVarNativesVarOptim[k] );
-		MemFree( problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDesBilansPays );
-		MemFree( problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContraintePourEviterLesChargesFictives );
-		
-
-
-		MemFree( problem.CorrespondanceCntNativesCntOptim[k]->NumeroPremiereContrainteDeReserveParZone );
-		MemFree( problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeuxiemeContrainteDeReserveParZone );		
-		MemFree( problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDeDissociationDeFlux );
-		MemFree( problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDesContraintesCouplantes );
-		MemFree( problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDesContraintesDeDureeMinDeMarche );		
-		MemFree( problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeContrainteDesContraintesDeDureeMinDArret );
-		MemFree( problem.CorrespondanceCntNativesCntOptim[k]->NumeroDeLaDeuxiemeContrainteDesContraintesDesGroupesQuiTombentEnPanne );		
-		MemFree( problem.CorrespondanceCntNativesCntOptim[k] );
-		MemFree( problem.VariablesDualesDesContraintesDeNTC[k]->VariableDualeParInterconnexion );
-		MemFree( problem.VariablesDualesDesContraintesDeNTC[k] );
-	}
-	MemFree( problem.ValeursDeNTC );
-	MemFree( problem.ConsommationsAbattues );
-	MemFree( problem.ValeursDeNTCRef );
-	MemFree( problem.ConsommationsAbattuesRef );
-	MemFree( problem.SoldeMoyenHoraire );
-	MemFree( problem.CorrespondanceVarNativesVarOptim );
-	MemFree( problem.CorrespondanceCntNativesCntOptim );
-	MemFree( problem.VariablesDualesDesContraintesDeNTC );
 
 	for ( int k = 0 ; k < (int) study.runtime->interconnectionsCount ; k++ ) {
 		MemFree( problem.CoutDeTransport[k]->CoutDeTransportOrigineVersExtremite );
@@ -416,25 +406,6 @@ void SIM_DesallocationProblemeHebdo( PROBLEME_HEBDO& problem )
 	MemFree(problem.MatriceDesContraintesCouplantes);
 
 	for (int k = 0; k < (int)nbPays; ++k) {
-
-		
-		const uint nbPaliers = (study.areas.byIndex[k])->thermal.list.size();
-
-		MemFree( problem.PaliersThermiquesDuPays[k]->PminDuPalierThermiquePendantUneHeure );
-		MemFree( problem.PaliersThermiquesDuPays[k]->PminDuPalierThermiquePendantUneSemaine );
-		MemFree( problem.PaliersThermiquesDuPays[k]->PminDuPalierThermiquePendantUnJour );
-		MemFree( problem.PaliersThermiquesDuPays[k]->ClasseDeManoeuvrabilite );
-		MemFree( problem.PaliersThermiquesDuPays[k]->TailleUnitaireDUnGroupeDuPalierThermique );
-		MemFree( problem.PaliersThermiquesDuPays[k]->NumeroDuPalierDansLEnsembleDesPaliersThermiques );
-
-		MemFree( problem.PaliersThermiquesDuPays[k]->CoutDeDemarrageDUnGroupeDuPalierThermique );
-		MemFree( problem.PaliersThermiquesDuPays[k]->CoutDArretDUnGroupeDuPalierThermique );
-		MemFree( problem.PaliersThermiquesDuPays[k]->CoutFixeDeMarcheDUnGroupeDuPalierThermique );
-		MemFree( problem.PaliersThermiquesDuPays[k]->PminDUnGroupeDuPalierThermique );
-		MemFree( problem.PaliersThermiquesDuPays[k]->PmaxDUnGroupeDuPalierThermique );
-		MemFree( problem.PaliersThermiquesDuPays[k]->DureeMinimaleDeMarcheDUnGroupeDuPalierThermique );
-		MemFree( problem.PaliersThermiquesDuPays[k]->DureeMinimaleDArretDUnGroupeDuPalierThermique );
-		
 		MemFree( problem.CaracteristiquesHydrauliques[k]->CntEnergieH2OParIntervalleOptimise );
 		MemFree( problem.CaracteristiquesHydrauliques[k]->CntEnergieH2OParJour );
 		MemFree( problem.CaracteristiquesHydrauliques[k]->CntEnergieH2OParIntervalleOptimiseRef );
@@ -453,41 +424,8 @@ void SIM_DesallocationProblemeHebdo( PROBLEME_HEBDO& problem )
 		MemFree( problem.ReserveJMoins1[k]->ReserveHoraireJMoins1Ref );
 		MemFree( problem.ReserveJMoins1[k] );
 
-		for (int j = 0; j < (int)nbPaliers; j++)
-		{
-			MemFree( problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->CoutHoraireDeProductionDuPalierThermique );
-			MemFree( problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->CoutHoraireDeProductionDuPalierThermiqueRef );
-			MemFree( problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->PuissanceDisponibleDuPalierThermique );
-			MemFree( problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->PuissanceDisponibleDuPalierThermiqueRef );
-			MemFree( problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->PuissanceDisponibleDuPalierThermiqueRef_SV );
-			MemFree( problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->PuissanceMinDuPalierThermique );
-			MemFree( problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->PuissanceMinDuPalierThermique_SV );
-			MemFree( problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->NombreMaxDeGroupesEnMarcheDuPalierThermique );
-			MemFree( problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j]->NombreMinDeGroupesEnMarcheDuPalierThermique );		
-			MemFree( problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout[j] );
-		}
-		MemFree( problem.PaliersThermiquesDuPays[k]->PuissanceDisponibleEtCout );
-		MemFree( problem.PaliersThermiquesDuPays[k] );
-		MemFree( problem.ResultatsHoraires[k]->ValeursHorairesDeDefaillancePositive );
-		MemFree( problem.ResultatsHoraires[k]->ValeursHorairesDeDefaillanceNegative );
-		MemFree( problem.ResultatsHoraires[k]->ValeursHorairesDeDefaillanceEnReserve );
-		MemFree( problem.ResultatsHoraires[k]->TurbinageHoraire );
-		MemFree( problem.ResultatsHoraires[k]->CoutsMarginauxHoraires );
-		for (int j = 0; j < problem.NombreDePasDeTemps; j++)
-		{
-			MemFree( problem.ResultatsHoraires[k]->ProductionThermique[j]->ProductionThermiqueDuPalier );
-			MemFree( problem.ResultatsHoraires[k]->ProductionThermique[j]->NombreDeGroupesEnMarcheDuPalier );
-			MemFree( problem.ResultatsHoraires[k]->ProductionThermique[j]->NombreDeGroupesQuiDemarrentDuPalier );
-			MemFree( problem.ResultatsHoraires[k]->ProductionThermique[j]->NombreDeGroupesQuiSArretentDuPalier );
-			MemFree( problem.ResultatsHoraires[k]->ProductionThermique[j]->NombreDeGroupesQuiTombentEnPanneDuPalier );
-			MemFree( problem.ResultatsHoraires[k]->ProductionThermique[j] );
-		}
-		MemFree( problem.ResultatsHoraires[k]->ProductionThermique );
-		MemFree( problem.ResultatsHoraires[k] );
-
 		MemFree( problem.BruitSurCoutHydraulique[k]);
 	}
-	MemFree( problem.PaliersThermiquesDuPays );
 	MemFree( problem.CaracteristiquesHydrauliques );
 	
 
@@ -495,7 +433,6 @@ void SIM_DesallocationProblemeHebdo( PROBLEME_HEBDO& problem )
 	MemFree( problem.NumeroDeZoneDeReserveJMoins1 );
 	MemFree( problem.CoutsMarginauxDesContraintesDeReserveParZone );
 	MemFree( problem.ReserveJMoins1 );
-	MemFree( problem.ResultatsHoraires );
 
 	MemFree( problem.CoutDeDefaillancePositive);
 	MemFree( problem.CoutDeDefaillanceNegative);
@@ -513,6 +450,9 @@ void SIM_DesallocationProblemeHebdo( PROBLEME_HEBDO& problem )
 	MemFree(problem.BruitSurCoutHydraulique);
 
 	MemFree(problem.CoutOptimalDeLaSolution);
+
+	
+	problem.arena.release();
 }
 
 
@@ -563,4 +503,28 @@ void PROBLEME_HEBDO::Manoeuvrabilite::reserve(uint nbAreas, uint nbLinks)
 	sum       = (double*) MemRealloc(sum,       sizeof(double) * nbAreas);
 }
 
+PROBLEME_HEBDO::Arena::Arena()
+	:pData(NULL), pSize(0), pCapacity(0)
+{}
+
+PROBLEME_HEBDO::Arena::~Arena()
+{
+	MemFree(pData);
+}
+
+void PROBLEME_HEBDO::Arena::reserve(size_t taille)
+{
+	MemFree(pData);
+	pData = (char*) MemAllocMemset(taille);
+	pSize = 0;
+	pCapacity = taille;
+}
+
+void PROBLEME_HEBDO::Arena::release()
+{
+	MemFree(pData);
+	pData = NULL;
+	pSize = 0;
+	pCapacity = 0;
+}
 
@@ -114,6 +114,10 @@ void SIM_InitialisationProblemeHebdo(Data::Study& study, PROBLEME_HEBDO& problem
 	
 	problem.ExportMPS					  = study.parameters.include.exportMPS; 
 
+	problem.RepartirDeLaBaseDeLAnneePrecedente = (study.parameters.warmStartAcrossYears) ? OUI_ANTARES : NON_ANTARES;
+	problem.RejouerLaSequenceDePresolve        = (study.parameters.replayPresolve) ? OUI_ANTARES : NON_ANTARES;
+	problem.NombreDeThreadsDePricing           = (int) study.parameters.simplexPricingThreads;
+
 	
 	problem.OptimisationAvecCoutsDeDemarrage = (study.parameters.unitCommitment.ucMode == Antares::Data::UnitCommitmentMode::ucMILP) ? OUI_ANTARES : NON_ANTARES ;
 
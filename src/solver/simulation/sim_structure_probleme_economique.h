@@ -32,6 +32,7 @@
 # define __SOLVER_SIMULATION_ECO_STRUCTS_H__
 
 # include "../optimisation/opt_structure_probleme_a_resoudre.h"
+# include <cstddef>
 
 # define GROSSES_VARIABLES  NON_ANTARES 
 # define COEFF_GROSSES_VARIABLES 100 
@@ -308,6 +309,15 @@ struct PROBLEME_HEBDO {
 	
 		
 	char ReinitOptimisation; 
+	/* OUI_ANTARES si le simplexe de chaque semaine repart de la base optimale de la meme semaine
+	   de l'annee precedente (voir PROBLEMES_SIMPLEXE) */
+	char RepartirDeLaBaseDeLAnneePrecedente;
+	/* OUI_ANTARES si le presolve du solveur PNE rejoue, d'une semaine a l'autre, les reductions
+	   enregistrees lors de la premiere semaine (voir SEQUENCE_DE_PRESOLVE) */
+	char RejouerLaSequenceDePresolve;
+	/* Nombre de threads utilises par le simplexe pour le calcul de la ligne pivot et le test
+	   du ratio (1: calcul sequentiel) */
+	int NombreDeThreadsDePricing;
 
 	
 
@@ -529,6 +539,48 @@ struct PROBLEME_HEBDO {
 
 	Manoeuvrabilite manoeuvrabilite;
 
+	/* Stockage contigu, en une seule allocation par probleme hebdo (donc par numSpace), des donnees
+	   par pas de temps, des paliers thermiques et des resultats horaires des pays : les pointeurs
+	   ci-dessus pointent dans ce bloc (voir SIM_AllocationProblemeHebdo) */
+	class Arena
+	{
+	public:
+		Arena();
+
+		~Arena();
+
+		/* Taille occupee dans le bloc par count elements de type T */
+		template<class T> static size_t Taille(size_t count)
+		{
+			return ((count * sizeof(T) + alignement - 1) / alignement) * alignement;
+		}
+
+		/* Alloue (et met a zero) le bloc, le precedent contenu est perdu */
+		void reserve(size_t taille);
+		/* Libere le bloc */
+		void release();
+
+		template<class T> T* allocate(size_t count)
+		{
+			T* p = (T*) (pData + pSize);
+			pSize += Taille<T>(count);
+			return p;
+		}
+
+		size_t size() const {return pSize;}
+
+		size_t capacity() const {return pCapacity;}
+
+	private:
+		enum { alignement = 16 };
+
+		char* pData;
+		size_t pSize;
+		size_t pCapacity;
+	};
+
+	Arena arena;
+
 	
 	double maxPminThermiqueByDay[366];
 
@@ -52,6 +52,12 @@ void SIM_AllocationTableaux(void);
 */
 void SIM_AllocationProblemeHebdo(PROBLEME_HEBDO& problem, int NombreDePasDeTemps);
 
+/*!
+** \brief Taille du bloc contigu (PROBLEME_HEBDO::arena) d'un probleme hebdo
+*/
+size_t SIM_TailleArenaProblemeHebdo(const Antares::Data::AreaList& areas, uint linkCount,
+	uint thermalPlantTotalCount, uint bindingConstraintCount, int NombreDePasDeTemps);
+
 /*!
 ** \brief Alloue et initialise un probleme hebdo
 */
@@ -28,11 +28,14 @@
 # define __SOLVER_SIMULATION_SOLVER_H__
 
 # include <vector>
+# include <deque>
 # include <yuni/yuni.h>
 # include <antares/study/memory-usage.h>
 # include <antares/study.h>
 # include <antares/logs.h>
 # include <yuni/core/string.h>
+# include <yuni/thread/mutex.h>
+# include <yuni/thread/signal.h>
 # include "../variable/state.h"
 # include "../misc/options.h"
 # include "solver.data.h"
@@ -49,6 +52,7 @@ namespace Simulation
 {
 
 	struct setOfParallelYears;
+	class spacesOfParallelYears;
 	class yearRandomNumbers;
 	class randomNumbers;
 	template<class Impl> class yearJob;
@@ -131,8 +135,37 @@ namespace Simulation
 		** \param	years			List of years	
 		*/
 		void computeRandomNumbers(	randomNumbers & randomForYears,
-									std::vector<uint> & years,
-									std::map<unsigned int, bool> & isYearPerformed	);
+									uint year,
+									bool isPerformed,
+									uint numSpace	);
+
+		/*!
+		** \brief Skip the random numbers of a year not performed
+		**
+		** The random generators are left in the same state as if the numbers
+		** had been drawn by computeRandomNumbers().
+		*/
+		void skipRandomNumbers();
+
+		/*!
+		** \brief Get a free space for the next MC year to perform
+		**
+		** Waits until a space is released, merging meanwhile the completed
+		** years into the synthesis.
+		*/
+		uint acquireSpaceForYear(spacesOfParallelYears & spaces);
+
+		/*!
+		** \brief Merge the completed years into the synthesis
+		**
+		** Years are merged in the order they were dispatched (ascending order),
+		** so that the synthesis does not depend on the number of parallel years.
+		**
+		** \param spaces         The spaces held by the years in progress
+		** \param untilAllMerged True to wait for all dispatched years, false to
+		**   return as soon as a space is free
+		*/
+		void mergeCompletedYears(spacesOfParallelYears & spaces, bool untilAllMerged);
 
 		/*!
 		** \brief Iterate through all MC years
@@ -319,19 +352,64 @@ namespace Simulation
 			void reset()
 			{
 				for(uint i = 0; i < pMaxNbPerformedYears; i++)	pYears[i].reset();
-
-				yearNumberToIndex.clear();
-
 			}
 
 		public:
 			uint pMaxNbPerformedYears;
+			// Random numbers of the year currently held by each space (indexed by numSpace)
 			yearRandomNumbers * pYears;
 
-			// Associates : 
-			//		year number (0, ..., total nb of years to compute - 1) --> index of the year's space (0, ..., max nb of parallel years - 1)
-			std::map<uint,uint> yearNumberToIndex;
+	};
+
+
+	/*!
+	** \brief Spaces (numSpace) held by the MC years in progress
+	**
+	** A year takes a space when it is dispatched and gives it back once
+	** its results have been merged into the synthesis. A freed space
+	** immediately picks up the next year, without waiting for the other
+	** years run in parallel.
+	*/
+	class spacesOfParallelYears
+	{
+		public:
+			struct yearInProgress
+			{
+				uint year;
+				uint numSpace;
+				// The set the year belongs to (for failures)
+				setOfParallelYears * set;
+			};
 
+		public:
+			explicit spacesOfParallelYears(uint nbSpaces) :
+				isSpaceFree(nbSpaces, true),
+				isYearCompleted(nbSpaces, false)
+			{}
+
+			/*!
+			** \brief Notify that the year held by a space is over (called from the year jobs)
+			*/
+			void notifyYearCompleted(uint numSpace)
+			{
+				{
+					Yuni::MutexLocker locker(mutex);
+					isYearCompleted[numSpace] = true;
+				}
+				signal.notify();
+			}
+
+		public:
+			//! Mutex for the completion flags
+			Yuni::Mutex mutex;
+			//! Signal raised each time a year is completed
+			Yuni::Thread::Signal signal;
+			//! Is a space available for a new year ?
+			std::vector<bool> isSpaceFree;
+			//! Has the year held by a space been completed ?
+			std::vector<bool> isYearCompleted;
+			//! Years dispatched but not merged yet, in dispatch order
+			std::deque<yearInProgress> yearsInProgress;
 	};
 	
 
@@ -35,6 +35,7 @@
 # include <antares/timeelapsed.h>
 # include "../aleatoire/alea_fonctions.h"
 # include "timeseries-numbers.h"
+# include "simulation.h"
 # include <antares/emergency.h>
 # include "../ts-generator/generator.h"
 # include <antares/memory/memory.h>
@@ -64,6 +65,7 @@ namespace Simulation
 						std::map<uint, bool> & pIsFirstPerformedYearOfASet,
 						unsigned int pNumSpace,
 						randomNumbers & pRandomForParallelYears,
+						spacesOfParallelYears & pSpaces,
 						bool pPerformCalculations,
 						Data::Study & pStudy,
 						std::vector<Variable::State> & pState,
@@ -75,6 +77,7 @@ namespace Simulation
 						isFirstPerformedYearOfASet(pIsFirstPerformedYearOfASet),
 						numSpace(pNumSpace), 
 						randomForParallelYears(pRandomForParallelYears),
+						spaces(pSpaces),
 						performCalculations(pPerformCalculations),
 						study(pStudy),
 						state(pState),
@@ -88,6 +91,7 @@ namespace Simulation
 			std::map<uint, bool> & isFirstPerformedYearOfASet;
 			unsigned int numSpace;
 			randomNumbers & randomForParallelYears;
+			spacesOfParallelYears & spaces;
 			bool performCalculations;
 			Data::Study & study;
 			std::vector<Variable::State> & state;
@@ -108,14 +112,16 @@ namespace Simulation
 
 				Progression::Task progression(study, y, Solver::Progression::sectYear);
 
+				// All blocks mapped by this job belong to the swap region of its numSpace,
+				// so the flushes below do not unmap the blocks of the other parallel years
+				if (Antares::Memory::swapSupport)
+					Antares::Memory::SelectRegion(numSpace + 1);
+
 				if (performCalculations)
 				{
-					
-					// Index of the current year in the list of structures
-					uint indexYear = randomForParallelYears.yearNumberToIndex[y];
 
-					// Getting random tables for this year
-					yearRandomNumbers & randomForCurrentYear = randomForParallelYears.pYears[indexYear];
+					// Getting random tables for this year (drawn when the year was dispatched)
+					yearRandomNumbers & randomForCurrentYear = randomForParallelYears.pYears[numSpace];
 					double ** thermalNoisesByArea = randomForCurrentYear.pThermalNoisesByArea;
 					double * randomReservoirLevel = randomForCurrentYear.pReservoirLevels;
 
@@ -139,7 +145,7 @@ namespace Simulation
 
 					// Flush all memory into the swap files
 					if (Antares::Memory::swapSupport)
-						Antares::memory.flushAll();
+						Antares::memory.flushRegion();
 					
 					// 6 - The Solver itself
 					uint failedWeek = 0;
@@ -155,7 +161,7 @@ namespace Simulation
 					// 6.5 - Flush all memory into the swap files
 					// This is mandatory for big studies, with numerous areas and thermal clusters
 					if (Antares::Memory::swapSupport)
-						Antares::memory.flushAll();
+						Antares::memory.flushRegion();
 
 					simulationObj->ImplementationType::variables.yearEndBuild(state[numSpace], y, numSpace);
 
@@ -166,7 +172,7 @@ namespace Simulation
 					// 7.5 - Flush all memory into the swap files
 					// This is mandatory for big studies, with numerous areas and thermal clusters
 					if (Antares::Memory::swapSupport)
-						Antares::memory.flushAll();
+						Antares::memory.flushRegion();
 
 					// 8 - Spatial clusters
 					// Notifying all variables to perform spatial aggregates.
@@ -195,7 +201,14 @@ namespace Simulation
 
 				// 10 - Flush all memory into the swap files
 				if (Antares::Memory::swapSupport)
-					Antares::memory.flushAll();
+				{
+					Antares::memory.flushRegion();
+					Antares::Memory::SelectRegion(0);
+				}
+
+				// 11 - The space can now be merged into the synthesis and released
+				if (performCalculations)
+					spaces.notifyYearCompleted(numSpace);
 
 			}	// End of onExecute() method
 	};
@@ -516,19 +529,6 @@ namespace Simulation
 
 		requiredMemoryForWeeklyPb += 5 * nbAreas * sizeof(int);
 
-		for (int k = 0; k < NombreDePasDeTemps; k++)
-		{
-			requiredMemoryForWeeklyPb += 16 * nbAreas * sizeof(double);
-		}
-
-		// -------------------------------------------------------
-		// Memory allocated based on the number of clusters
-		// -------------------------------------------------------
-		for (int k = 0; k < NombreDePasDeTemps; k++)
-		{
-			requiredMemoryForWeeklyPb += 8 * thermalPlantTotalCount * sizeof(int);
-		}
-
 		// -------------------------------------------------
 		// Memory allocated based on the number of links
 		// -------------------------------------------------
@@ -536,23 +536,12 @@ namespace Simulation
 
 		requiredMemoryForWeeklyPb += nbLinks * sizeof(void *);
 
-		for (int k = 0; k < NombreDePasDeTemps; k++)
-		{
-			requiredMemoryForWeeklyPb += 9 * nbLinks * sizeof(double);
-			requiredMemoryForWeeklyPb += 4 * nbLinks * sizeof(int);
-		}
-
 
 		// ----------------------------------------------------------------
 		// Memory allocated based on the number of binding constraints
 		// ----------------------------------------------------------------
 		requiredMemoryForWeeklyPb += nbBindingConstraints * sizeof(void *);
 
-		for (int k = 0; k < NombreDePasDeTemps; k++)
-		{
-			requiredMemoryForWeeklyPb += nbBindingConstraints * sizeof(int);
-		}
-
 		for (int k = 0; k < 7; k++)
 		{
 			requiredMemoryForWeeklyPb += nbBindingConstraints * sizeof(int);
@@ -570,8 +559,6 @@ namespace Simulation
 		// -----------------------------------------------------
 		requiredMemoryForWeeklyPb += 4 * NombreDePasDeTemps * sizeof(int);
 
-		requiredMemoryForWeeklyPb += 8 * NombreDePasDeTemps * sizeof(void *);
-
 		for (int k = 0 ; k < (int)nbLinks ; ++k)
 		{
 			requiredMemoryForWeeklyPb += NombreDePasDeTemps * sizeof(COUTS_DE_TRANSPORT);
@@ -583,34 +570,12 @@ namespace Simulation
 			requiredMemoryForWeeklyPb += 2 * NombreDePasDeTemps * sizeof(int);
 		}
 
-		for (int k = 0; k < (int)nbAreas; k++)
-		{
-			const uint nbPaliers = (study.areas.byIndex[k])->thermal.list.size();
-			
-			requiredMemoryForWeeklyPb += 10 * NombreDePasDeTemps * sizeof(double);
-			requiredMemoryForWeeklyPb += NombreDePasDeTemps * sizeof(void *);
-
-			for (int j = 0; j < (int)nbPaliers; ++j)
-			{
-				requiredMemoryForWeeklyPb += 7 * NombreDePasDeTemps * sizeof(double);
-				requiredMemoryForWeeklyPb += 2 * NombreDePasDeTemps * sizeof(int);
-			}
-		}
+		requiredMemoryForWeeklyPb += 5 * nbAreas * NombreDePasDeTemps * sizeof(double);
 
 
 		// ---------------------------------------------
 		// Memory allocated based on other things
 		// ---------------------------------------------
-		for (int k = 0; k < NombreDePasDeTemps; k++)
-		{
-			requiredMemoryForWeeklyPb += 2 * sizeof(VALEURS_DE_NTC_ET_RESISTANCES);
-			requiredMemoryForWeeklyPb += 2 * sizeof(CONSOMMATIONS_ABATTUES);
-			requiredMemoryForWeeklyPb += sizeof(SOLDE_MOYEN_DES_ECHANGES);
-			requiredMemoryForWeeklyPb += sizeof(CORRESPONDANCES_DES_VARIABLES);
-			requiredMemoryForWeeklyPb += sizeof(CORRESPONDANCES_DES_CONTRAINTES);
-			requiredMemoryForWeeklyPb += sizeof(VARIABLES_DUALES_INTERCONNEXIONS);
-		}
-
 		requiredMemoryForWeeklyPb += 7 * sizeof(void *);
 
 		for (int k = 0; k < 7; k++)
@@ -621,34 +586,19 @@ namespace Simulation
 			requiredMemoryForWeeklyPb += sizeof(CONTRAINTES_COUPLANTES);
 		}
 
-		for (int k = 0; k < (int)nbAreas; k++)
-		{
-			const uint nbPaliers = (study.areas.byIndex[k])->thermal.list.size();
-
-			requiredMemoryForWeeklyPb += sizeof(PALIERS_THERMIQUES);
-			requiredMemoryForWeeklyPb += sizeof(ENERGIES_ET_PUISSANCES_HYDRAULIQUES);
-			requiredMemoryForWeeklyPb += sizeof(COUTS_MARGINAUX_ZONES_DE_RESERVE);
-			requiredMemoryForWeeklyPb += sizeof(RESERVE_JMOINS1);
-			requiredMemoryForWeeklyPb += sizeof(RESULTATS_HORAIRES);
-			requiredMemoryForWeeklyPb += nbPaliers * sizeof(CLASSE_DE_MANOEUVRABILITE);
-			requiredMemoryForWeeklyPb += 30 * nbPaliers * sizeof(double);
-			requiredMemoryForWeeklyPb += 6 * nbPaliers * sizeof(int);
-			requiredMemoryForWeeklyPb += nbPaliers * sizeof(void *);
-
-			for (int j = 0; j < (int)nbPaliers; ++j)
-			{
-				requiredMemoryForWeeklyPb += sizeof(PDISP_ET_COUTS_HORAIRES_PAR_PALIER);
-			}
-
-			for (int j = 0; j < NombreDePasDeTemps; j++)
-			{
-				requiredMemoryForWeeklyPb += sizeof(PRODUCTION_THERMIQUE_OPTIMALE);
-				requiredMemoryForWeeklyPb += 5 * nbPaliers * sizeof(double);
-			}
-		}
+		requiredMemoryForWeeklyPb += nbAreas * sizeof(ENERGIES_ET_PUISSANCES_HYDRAULIQUES);
+		requiredMemoryForWeeklyPb += nbAreas * sizeof(COUTS_MARGINAUX_ZONES_DE_RESERVE);
+		requiredMemoryForWeeklyPb += nbAreas * sizeof(RESERVE_JMOINS1);
 
 		requiredMemoryForWeeklyPb += 7 * sizeof(double);	// cout optimal de la solution
 
+		// ----------------------------------------------------------------------------
+		// Arena : data per time step, thermal clusters and hourly results per area
+		// (same layout as in SIM_AllocationProblemeHebdo)
+		// ----------------------------------------------------------------------------
+		requiredMemoryForWeeklyPb += SIM_TailleArenaProblemeHebdo(study.areas, nbLinks,
+			thermalPlantTotalCount, nbBindingConstraints, NombreDePasDeTemps);
+
 		// ---------------------------------------------
 		// Adding memory from weekly problems  
 		// ---------------------------------------------
@@ -1080,124 +1030,128 @@ namespace Simulation
 
 	template<class Impl>
 	void ISimulation<Impl>::computeRandomNumbers(	randomNumbers & randomForYears,
-													std::vector<uint> & years,
-													std::map<unsigned int, bool> & isYearPerformed
+													uint y,
+													bool isPerformed,
+													uint numSpace
 												)
 	{
 		auto& runtime = * study.runtime;
-		
-		uint indexYear = 0;
-		std::vector<unsigned int>::iterator ity;
-		for(ity = years.begin(); ity != years.end(); ++ity)
-		{
-			uint y = *ity;
-			bool isPerformed = isYearPerformed[y];
-			if (isPerformed)
-				randomForYears.yearNumberToIndex[y] = indexYear;
 
-			// logs.info() << "Year : " << y << " ------------";
+		// Random numbers must be drawn year after year, even for the years not performed,
+		// to keep the same sequences whatever the playlist and the number of parallel years.
 
-			// General
-			const unsigned int nbAreas = study.areas.size();
+		// General
+		const unsigned int nbAreas = study.areas.size();
 
-			// ... Thermal noise ...
-			for (unsigned int a = 0; a != nbAreas; ++a)
-			{
-				// logs.info() << "   area : " << a << " :";
-				auto& area = *(study.areas.byIndex[a]);
-				size_t nbClusters = area.thermal.list.mapping.size();
+		if (not isPerformed)
+		{
+			// The random numbers of a year not performed are only skipped, without being
+			// computed (see MersenneTwister::discard()).
+			skipRandomNumbers();
+			return;
+		}
 
-				for (uint c = 0; c != nbClusters; ++c)
-				{
-					if (isPerformed)
-						randomForYears.pYears[indexYear].pThermalNoisesByArea[a][c] = runtime.random[Data::seedThermalCosts].next();
-					else
-						runtime.random[Data::seedThermalCosts].next();
-					// logs.info() << "      cluster : " << c << ", value : " << randomForYears.pYears[indexYear].pThermalNoisesByArea[a][c];
-				}
-			}
+		auto& yearRandom = randomForYears.pYears[numSpace];
 
-			// ... Reservoir levels ...
-			uint areaIndex = 0;
-			study.areas.each([&] (Data::Area& area)
-			{
-				// looking for the initial reservoir level (begining of the year)
-				auto& min = area.hydro.reservoirLevel[Data::PartHydro::minimum];
-				auto& avg = area.hydro.reservoirLevel[Data::PartHydro::average];
-				auto& max = area.hydro.reservoirLevel[Data::PartHydro::maximum];
-				// Whatever the case, we always draw a random initial reservoir level
-				// to ensure the same results whether if the reservoir management is enable
-				// or not.
-				if (isPerformed)
-					randomForYears.pYears[indexYear].pReservoirLevels[areaIndex] = pHydroManagement.randomReservoirLevel(min[0], avg[0], max[0]);
-				else
-					pHydroManagement.randomReservoirLevel(min[0], avg[0], max[0]);
-				areaIndex++;
-			}); // each area
-			
-			
-			// ... Unsupplied energy noise (french : bruit sur la defaillance positive) ...
-			// references to the random number generators
-			auto& randomUnsupplied = study.runtime->random[Data::seedUnsuppliedEnergyCosts];
-			areaIndex = 0;
-			study.areas.each([&] (Data::Area& area)
-			{
-				if (isPerformed)
-					randomForYears.pYears[indexYear].pUnsuppliedEnergy[areaIndex] = randomUnsupplied();
-				else
-					randomUnsupplied();
+		// ... Thermal noise ...
+		for (unsigned int a = 0; a != nbAreas; ++a)
+		{
+			auto& area = *(study.areas.byIndex[a]);
+			size_t nbClusters = area.thermal.list.mapping.size();
 
-				areaIndex++;
-			}); // each area
-			
-			// ... Hydro costs noises ...
-			auto& randomHydro = study.runtime->random[Data::seedHydroCosts];
+			for (uint c = 0; c != nbClusters; ++c)
+				yearRandom.pThermalNoisesByArea[a][c] = runtime.random[Data::seedThermalCosts].next();
+		}
 
-			Data::PowerFluctuations powerFluctuations = study.parameters.power.fluctuations;
-			switch (powerFluctuations)
+		// ... Reservoir levels ...
+		uint areaIndex = 0;
+		study.areas.each([&] (Data::Area& area)
+		{
+			// looking for the initial reservoir level (begining of the year)
+			auto& min = area.hydro.reservoirLevel[Data::PartHydro::minimum];
+			auto& avg = area.hydro.reservoirLevel[Data::PartHydro::average];
+			auto& max = area.hydro.reservoirLevel[Data::PartHydro::maximum];
+			// Whatever the case, we always draw a random initial reservoir level
+			// to ensure the same results whether if the reservoir management is enable
+			// or not.
+			yearRandom.pReservoirLevels[areaIndex] = pHydroManagement.randomReservoirLevel(min[0], avg[0], max[0]);
+			areaIndex++;
+		}); // each area
+		
+		
+		// ... Unsupplied energy noise (french : bruit sur la defaillance positive) ...
+		// references to the random number generators
+		auto& randomUnsupplied = study.runtime->random[Data::seedUnsuppliedEnergyCosts];
+		for (uint a = 0; a != nbAreas; ++a)
+			yearRandom.pUnsuppliedEnergy[a] = randomUnsupplied();
+		
+		// ... Hydro costs noises ...
+		auto& randomHydro = study.runtime->random[Data::seedHydroCosts];
+
+		Data::PowerFluctuations powerFluctuations = study.parameters.power.fluctuations;
+		switch (powerFluctuations)
+		{
+			case Data::lssFreeModulations:
 			{
-				case Data::lssFreeModulations:
+				for (uint a = 0; a != nbAreas; ++a)
 				{
-					areaIndex = 0;
-					auto end = study.areas.end();
-					for (auto i = study.areas.begin(); i != end; ++i)
-					{
-						for (uint j = 0; j != 8784; ++j)
-						{
-							if (isPerformed)
-								randomForYears.pYears[indexYear].pHydroCostsByArea_freeMod[areaIndex][j] = randomHydro();
-							else
-								randomHydro();
-						}
-
-						areaIndex++;
-					}
-					break;
+					double* hydroCosts = yearRandom.pHydroCostsByArea_freeMod[a];
+					for (uint j = 0; j != 8784; ++j)
+						hydroCosts[j] = randomHydro();
 				}
+				break;
+			}
 
-				case Data::lssMinimizeRamping:
-				case Data::lssMinimizeExcursions:
-				{
-					areaIndex = 0;
-					auto end = study.areas.end();
-					for (auto i = study.areas.begin(); i != end; ++i)
-					{
-						if (isPerformed)
-							randomForYears.pYears[indexYear].pHydroCosts_rampingOrExcursion[areaIndex] = randomHydro();
-						else
-							randomHydro();
+			case Data::lssMinimizeRamping:
+			case Data::lssMinimizeExcursions:
+			{
+				for (uint a = 0; a != nbAreas; ++a)
+					yearRandom.pHydroCosts_rampingOrExcursion[a] = randomHydro();
+				break;
+			}
 
-						areaIndex++;
-					}
-					break;
-				}
+		} // end of switch
+	}	// End function 
 
-			} // end of switch
 
-			if (isPerformed) indexYear++;
+	template<class Impl>
+	void ISimulation<Impl>::skipRandomNumbers()
+	{
+		auto& runtime = * study.runtime;
+		const uint nbAreas = study.areas.size();
+
+		// ... Thermal noise ...
+		Yuni::uint64 nbClusters = 0;
+		for (uint a = 0; a != nbAreas; ++a)
+			nbClusters += study.areas.byIndex[a]->thermal.list.mapping.size();
+		runtime.random[Data::seedThermalCosts].discard(nbClusters);
+
+		// ... Reservoir levels ...
+		// The number of draws of a reservoir level is not known in advance (rejection
+		// method) : they are still performed
+		study.areas.each([&] (Data::Area& area)
+		{
+			auto& min = area.hydro.reservoirLevel[Data::PartHydro::minimum];
+			auto& avg = area.hydro.reservoirLevel[Data::PartHydro::average];
+			auto& max = area.hydro.reservoirLevel[Data::PartHydro::maximum];
+			pHydroManagement.randomReservoirLevel(min[0], avg[0], max[0]);
+		});
 
-		}	// End loop over years
-	}	// End function 
+		// ... Unsupplied energy noise ...
+		runtime.random[Data::seedUnsuppliedEnergyCosts].discard(nbAreas);
+
+		// ... Hydro costs noises ...
+		switch (study.parameters.power.fluctuations)
+		{
+			case Data::lssFreeModulations:
+				runtime.random[Data::seedHydroCosts].discard((Yuni::uint64) nbAreas * 8784);
+				break;
+			case Data::lssMinimizeRamping:
+			case Data::lssMinimizeExcursions:
+				runtime.random[Data::seedHydroCosts].discard(nbAreas);
+				break;
+		}
+	}
 
 	template<class Impl>
 	template<bool PerformCalculationsT>
@@ -1215,48 +1169,49 @@ namespace Simulation
 		// List of parallel years sets
 		std::vector<setOfParallelYears> setsOfParallelYears;
 
-		// Gets information on each set of parallel years and returns the max number of years performed in a set
-		// The variable "maxNbYearsPerformedInAset" is the maximum numbers of years to be actually executed in a set.
+		// Gets information on each set of parallel years.
 		// A set contains some years to be actually executed (at most "pNbMaxPerformedYearsInParallel" years) and some others
-		// to skip.
-		uint maxNbYearsPerformedInAset = buildSetsOfParallelYears<PerformCalculationsT>(	firstYear, 
-																							endYear, 
-																							setsOfParallelYears
-																						);
+		// to skip. Sets are only used for logging and for the time-series refresh : the years of consecutive sets
+		// are streamed over the spaces, a freed space immediately picking up the next year to perform.
+		buildSetsOfParallelYears<PerformCalculationsT>(firstYear, endYear, setsOfParallelYears);
 
-		// Container for random numbers of parallel years (to be executed or not)
-		randomNumbers randomForParallelYears(maxNbYearsPerformedInAset, study.parameters.power.fluctuations);
+		// Container for random numbers of parallel years (one storage per space)
+		randomNumbers randomForParallelYears(pNbMaxPerformedYearsInParallel, study.parameters.power.fluctuations);
 
 		// Allocating memory to store random numbers of all parallel years
 		allocateMemoryForRandomNumbers(randomForParallelYears);
 
-		// The queue service that runs every set of parallel years
+		// Spaces currently held by the years in progress
+		spacesOfParallelYears spaces(pNbMaxPerformedYearsInParallel);
+
+		// The queue service that runs all years
 		Yuni::Job::QueueService qs;
 		// Number of threads to perform the jobs waiting in the queue
 		qs.maximumThreadCount(pNbMaxPerformedYearsInParallel);
+		qs.start();
 
 		// Loop over sets of parallel years 
 		std::vector<setOfParallelYears>::iterator set_it;
 		for(set_it = setsOfParallelYears.begin(); set_it != setsOfParallelYears.end(); ++set_it)
 		{
-			
 			logs.info() << "nb years in set : " << set_it->nbYears;
 			// 1 - We may want to regenerate the time-series this year.
 			// This is the case when the preprocessors are enabled from the
 			// interface and/or the refresh is enabled.
+			// All years using the previous time-series must be over before.
 			if(set_it->regenerateTS)
+			{
+				mergeCompletedYears(spaces, true);
+				qs.wait(Yuni::qseIdle);
 				regenerateTimeSeries<false>(set_it->yearForTSgeneration);
-			
-			computeRandomNumbers(randomForParallelYears, set_it->yearsIndices, set_it->isYearPerformed);
+			}
 
 			std::vector<unsigned int>::iterator year_it;
-			std::vector<unsigned int> yearsIndicesCopy(set_it->yearsIndices);
-
 			for(year_it = set_it->yearsIndices.begin(); year_it != set_it->yearsIndices.end(); ++year_it)
 			{
 				// Get the index of the year
 				unsigned int y = *year_it;
-				
+
 				// Another year
 				++pNbYearsReallyPerformed;
 
@@ -1264,28 +1219,32 @@ namespace Simulation
 				unsigned int numSpace = 999999;
 				if(performCalculations)
 				{
-					numSpace = set_it->performedYearToSpace[y];
+					// Waiting for a space to be released by a previous year
+					numSpace = acquireSpaceForYear(spaces);
 					study.runtime->timeseriesNumberYear[numSpace] = y;
 					study.runtime->currentYear[numSpace] = y;
+
+					spacesOfParallelYears::yearInProgress inProgress;
+					inProgress.year = y;
+					inProgress.numSpace = numSpace;
+					inProgress.set = &(*set_it);
+
+					Yuni::MutexLocker locker(spaces.mutex);
+					spaces.yearsInProgress.push_back(inProgress);
 				}
 
-				// gp - todo : ==================================================================================
-				// gp - todo : Dans le cas d'une boucle "while" avant la boucle "for" concernant la gestion 
-				// gp - todo : des AMC qui ne trouvent pas de solution, ce qui suit peut tre utile.
-				// gp - todo : ==================================================================================
-				// If the year has not to be rerun, we skip the computation of the year
-				// Note that, when we enter for the first time in the "for" loop, all years
-				// of the set have to be rerun (meaning : they must be run once).
-				// if(!set_it->yearFailed[y]) continue;
+				// Random numbers are drawn in the order of the years
+				computeRandomNumbers(randomForParallelYears, y, performCalculations, numSpace);
 
 				qs.add(
 						new yearJob<ImplementationType>(	this,
 															y,
-															yearsIndicesCopy,
+															set_it->yearsIndices,
 															set_it->yearFailed,
 															set_it->isFirstPerformedYearOfASet,
 															numSpace, 
 															randomForParallelYears,
+															spaces,
 															performCalculations,
 															study,
 															state,
@@ -1295,44 +1254,98 @@ namespace Simulation
 
 			} // End loop over years of the current set of parallel years
 
-			qs.start();
+		} // End loop over sets of parallel years
+
+		// Merging the last years
+		mergeCompletedYears(spaces, true);
+
+		qs.wait(Yuni::qseIdle);
+		qs.stop();
+	}
 
-			qs.wait(Yuni::qseIdle);
-			qs.stop();
 
-			// On regarde si au moins une anne du lot n'a pas trouv de solution
-			std::map<uint, bool>::iterator it;
-			bool foundFailure = false;
-			for(it = set_it->yearFailed.begin(); it != set_it->yearFailed.end(); it++)
+	template<class Impl>
+	uint ISimulation<Impl>::acquireSpaceForYear(spacesOfParallelYears & spaces)
+	{
+		mergeCompletedYears(spaces, false);
+
+		Yuni::MutexLocker locker(spaces.mutex);
+		for (uint numSpace = 0; numSpace != spaces.isSpaceFree.size(); ++numSpace)
+		{
+			if (spaces.isSpaceFree[numSpace])
 			{
-				if(it->second)
-				{
-					foundFailure = true;
-					break;
-				}
+				spaces.isSpaceFree[numSpace] = false;
+				return numSpace;
 			}
-			// Si une anne du lot d'annes n'a pas trouv de solution, on arrte tout
-			if(foundFailure)
+		}
+		assert(false and "no free space");
+		return 999999;
+	}
+
+
+	template<class Impl>
+	void ISimulation<Impl>::mergeCompletedYears(spacesOfParallelYears & spaces, bool untilAllMerged)
+	{
+		for (;;)
+		{
+			// Merging the completed years, as long as all the years
+			// dispatched before them are merged as well
+			for (;;)
 			{
-				logs.fatal() << "At least one year has failed in the previous set of parallel year.";
-				AntaresSolverEmergencyShutdown();
-			}
+				spacesOfParallelYears::yearInProgress inProgress;
+				{
+					Yuni::MutexLocker locker(spaces.mutex);
+					if (spaces.yearsInProgress.empty())
+						break;
+					inProgress = spaces.yearsInProgress.front();
+					if (not spaces.isYearCompleted[inProgress.numSpace])
+						break;
+				}
+
+				// Si l'annee n'a pas trouve de solution, on arrete tout
+				if (inProgress.set->yearFailed[inProgress.year])
+				{
+					logs.fatal() << "Year " << (inProgress.year + 1) << " has failed.";
+					AntaresSolverEmergencyShutdown();
+				}
 
-			// Computing the summary : adding the contribution of MC years 
-			// previously computed in parallel
-			ImplementationType::variables.computeSummary(set_it->spaceToPerformedYear, set_it->nbPerformedYears);
+				std::map<unsigned int, unsigned int> spaceToYear;
+				spaceToYear[inProgress.numSpace] = inProgress.year;
 
-			
-			// Computing summary of spatial aggregations
-			ImplementationType::variables.computeSpatialAggregatesSummary(	ImplementationType::variables, 
-																			set_it->spaceToPerformedYear,
-																			set_it->nbPerformedYears	);
-			
-			// Set to zero the random numbers of all parallel years
-			randomForParallelYears.reset();
+				// Computing the summary : adding the contribution of the MC year
+				ImplementationType::variables.computeSummary(spaceToYear, 1);
 
-		} // End loop over sets of parallel years
+				// Computing summary of spatial aggregations
+				ImplementationType::variables.computeSpatialAggregatesSummary(	ImplementationType::variables,
+																				spaceToYear, 1);
 
+				// The space is now available for another year
+				Yuni::MutexLocker locker(spaces.mutex);
+				spaces.yearsInProgress.pop_front();
+				spaces.isYearCompleted[inProgress.numSpace] = false;
+				spaces.isSpaceFree[inProgress.numSpace] = true;
+			}
+
+			{
+				Yuni::MutexLocker locker(spaces.mutex);
+				if (untilAllMerged)
+				{
+					if (spaces.yearsInProgress.empty())
+						return;
+				}
+				else
+				{
+					for (uint numSpace = 0; numSpace != spaces.isSpaceFree.size(); ++numSpace)
+					{
+						if (spaces.isSpaceFree[numSpace])
+							return;
+					}
+				}
+			}
+
+			// Waiting for another year to complete
+			spaces.signal.waitAndReset();
+		}
 	}
 
 
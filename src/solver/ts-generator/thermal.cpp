@@ -41,6 +41,9 @@
 #include "../simulation/sim_structure_probleme_adequation.h"
 #include "../simulation/sim_extern_variables_globales.h"
 #include "../aleatoire/alea_fonctions.h"
+#include <yuni/job/job.h>
+#include <yuni/job/queue/service.h>
+#include <vector>
 
 using namespace Yuni;
 
@@ -199,6 +202,12 @@ namespace TSGenerator
 
 			void operator () (Data::Area& area, Data::ThermalCluster& cluster);
 
+			//! Reset the random number generator (one stream per cluster)
+			void resetRandomGenerator(uint seed)
+			{
+				rndgenerator.reset(seed);
+			}
+
 		public:
 			
 			Data::Study& study;
@@ -248,7 +257,7 @@ namespace TSGenerator
 			const uint daysPerYear;
 
 			
-			MersenneTwister& rndgenerator;
+			MersenneTwister rndgenerator;
 
 			
 			double AVP[366];
@@ -300,7 +309,6 @@ namespace TSGenerator
 			study(study),
 			nbHoursPerYear(study.runtime->nbHoursPerYear),
 			daysPerYear(study.runtime->nbDaysPerYear),
-			rndgenerator(study.runtime->random[Data::seedTsGenThermal]),
 			pProgression(progr)
 		{
 			
@@ -914,6 +922,78 @@ namespace TSGenerator
 			if (economyMode)
 				cluster.calculationOfSpinning();
 		}
+
+
+		//! A thermal cluster to regenerate, with the seed of its own random stream
+		struct ClusterToGenerate final
+		{
+			Data::Area* area;
+			Data::ThermalCluster* cluster;
+			uint seed;
+		};
+
+
+		//! Generate the time-series of the clusters first, first + step, ...
+		void GenerateClusters(GeneratorTempData& generator, const std::vector<ClusterToGenerate>& clusters,
+			Solver::Progression::Task& progression, uint first, uint step)
+		{
+			for (uint i = first; i < (uint) clusters.size(); i += step)
+			{
+				auto& item = clusters[i];
+				generator.resetRandomGenerator(item.seed);
+				generator(*item.area, *item.cluster);
+
+				++progression;
+				# ifdef ANTARES_SWAP_SUPPORT
+				// Only the matrices of the cluster: the other jobs are still
+				// writing the series of their own clusters (flushAll() would
+				// unmap them)
+				item.cluster->series->series.flush();
+				if (item.cluster->prepro)
+					item.cluster->prepro->data.flush();
+				item.cluster->modulation.flush();
+				# endif
+			}
+		}
+
+
+		/*!
+		** \brief Job for generating the time-series of some thermal clusters
+		**
+		** The job handles the clusters first, first + step, ... with its own
+		** temporary data.
+		*/
+		class ThermalGenerationJob final : public Yuni::Job::IJob
+		{
+		public:
+			ThermalGenerationJob(GeneratorTempData* generator, const std::vector<ClusterToGenerate>& clusters,
+				Solver::Progression::Task& progression, uint first, uint step) :
+				pGenerator(generator),
+				pClusters(clusters),
+				pProgression(progression),
+				pFirst(first),
+				pStep(step)
+			{}
+
+			virtual ~ThermalGenerationJob()
+			{
+				delete pGenerator;
+			}
+
+		private:
+			virtual void onExecute() override
+			{
+				GenerateClusters(*pGenerator, pClusters, pProgression, pFirst, pStep);
+			}
+
+		private:
+			GeneratorTempData* pGenerator;
+			const std::vector<ClusterToGenerate>& pClusters;
+			Solver::Progression::Task& pProgression;
+			uint pFirst;
+			uint pStep;
+		};
+
 	} 
 
 
@@ -936,33 +1016,52 @@ namespace TSGenerator
 		if (generator->archive)
 			generator->prepareOutputFoldersForAllAreas(year);
 
-		# ifdef ANTARES_SWAP_SUPPORT
-		auto& swap = Antares::memory;
-		# endif
-
-		
+		// One random stream per cluster, seeded in the order of the clusters from
+		// the thermal generator of the study : the results do not depend on the
+		// number of threads
+		auto& rndgenerator = study.runtime->random[Data::seedTsGenThermal];
+		std::vector<ClusterToGenerate> clusters;
 		study.areas.each([&] (Data::Area& area)
 		{
-			
 			for (uint i = 0; i != area.thermal.clusterCount; ++i)
 			{
-				
-				auto& cluster = *(area.thermal.clusters[i]);
-				
-				(*generator)(area, cluster);
-
-				
-				++progression;
-				# ifdef ANTARES_SWAP_SUPPORT
-				
-				
-				swap.flushAll();
-				# endif
+				ClusterToGenerate item;
+				item.area    = &area;
+				item.cluster = area.thermal.clusters[i];
+				// next() lies in [0, 1], both bounds included
+				item.seed    = (uint) Math::Min(rndgenerator.next() * 4294967295., 4294967295.);
+				clusters.push_back(item);
 			}
 		});
 
-		
-		delete generator;
+		uint nbThreads = Math::Max<uint>(1, study.maxNbYearsInParallel);
+		if (nbThreads > clusters.size())
+			nbThreads = Math::Max<uint>(1, (uint) clusters.size());
+
+		if (nbThreads == 1)
+		{
+			GenerateClusters(*generator, clusters, progression, 0, 1);
+			delete generator;
+		}
+		else
+		{
+			Job::QueueService qs;
+			qs.maximumThreadCount(nbThreads);
+			qs.start();
+			for (uint t = 0; t != nbThreads; ++t)
+			{
+				GeneratorTempData* data = generator;
+				if (t != 0)
+				{
+					data = new GeneratorTempData(study, progression);
+					data->currentYear = year;
+					data->archive     = generator->archive;
+				}
+				qs.add(new ThermalGenerationJob(data, clusters, progression, t, nbThreads));
+			}
+			qs.wait(Yuni::qseIdle);
+			qs.stop();
+		}
 
 		return true;
 	}
@@ -50,6 +50,39 @@ namespace XCast
 {
 
 
+	bool XCast::prepareCorrelationMatrices()
+	{
+		uint processCount = (uint) pData.localareas.size();
+
+		for (uint realmonth = 0; realmonth != 12; ++realmonth)
+		{
+			const Matrix<float>* corr = pData.correlation[realmonth];
+			if (not corr)
+				continue;
+
+			if (Cholesky<float>(Triangle_courant, corr->entry, processCount, pQCHOLTotal))
+			{
+				
+				
+				for (uint i = 0; i != processCount; ++i)
+				{
+					
+					for (uint j = 0; j < i; ++j)
+						corr->entry[i][j] *= 0.999f;
+				}
+
+				if (Cholesky<float>(Triangle_courant, corr->entry, processCount, pQCHOLTotal))
+				{
+					
+					logs.error() << "TS " << pTSName << " generator: invalid correlation matrix";
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+
 	bool XCast::generateValuesForTheCurrentDay()
 	{
 		enum { nbHoursADay = 24, };
@@ -66,9 +99,9 @@ namespace XCast
 
 		
 		
-		if (pNeverInitialized)
+		if (pNewSeries)
 		{
-			pNeverInitialized = false;
+			pNewSeries = false;
 			pNewMonth = true;
 			for (uint s = 0; s != processCount; ++s)
 			{
@@ -85,25 +118,7 @@ namespace XCast
 		
 		if (pNewMonth)
 		{
-			if (Cholesky<float>(Triangle_courant, pCorrMonth->entry, processCount, pQCHOLTotal))
-			{
-				
-				
-				for (uint i = 0; i != processCount; ++i)
-				{
-					
-					for (uint j = 0; j < i; ++j)
-						pCorrMonth->entry[i][j] *= 0.999f;
-				}
-
-				if (Cholesky<float>(Triangle_courant, pCorrMonth->entry, processCount, pQCHOLTotal))
-				{
-					
-					logs.error() << "TS " << pTSName << " generator: invalid correlation matrix";
-					return false;
-				}
-			}
-
+			// The correlation matrices have already been checked (see prepareCorrelationMatrices())
 			for (uint s = 0; s != processCount; ++s)
 			{
 				MAXI[s]  = maximum(   A[s], B[s], G[s], D[s], L[s]);
@@ -124,45 +139,64 @@ namespace XCast
 				D_COPIE[s] = diffusion(A[s], B[s], G[s], D[s], L[s], T[s], ESPE[s]);
 			}
 
-			
-			for (uint s = 0; s != processCount; ++s)
+			// The correlation matrix of the month and its decomposition do not depend
+			// on the time-series : they are computed only once
+			float** factor = (pAccuracyOnCorrelation) ? Carre_reference : Triangle_courant;
+			float*& cache = pMonthlyFactor[pRealMonth];
+			if (not cache)
 			{
-				for (uint t = 0; t < s; ++t)
+				uint levellingCount = pLevellingCount;
+			
+				for (uint s = 0; s != processCount; ++s)
 				{
-					float z = D_COPIE[t] * STDE[s];
-					if (Math::Zero(z))
-						CORR[s][t] = 0.f;
-					else
+					for (uint t = 0; t < s; ++t)
 					{
-						x = D_COPIE[s] * STDE[t] / z;
-						CORR[s][t] = (*pCorrMonth)[s][t] * (x + 1.f / x) / 2.f;
-						if (CORR[s][t] >  1.f)
-						{
-							CORR[s][t] = 1.f;
-							++pLevellingCount;
-						}
+						float z = D_COPIE[t] * STDE[s];
+						if (Math::Zero(z))
+							CORR[s][t] = 0.f;
 						else
 						{
-							if (CORR[s][t] < -1.f)
+							x = D_COPIE[s] * STDE[t] / z;
+							CORR[s][t] = (*pCorrMonth)[s][t] * (x + 1.f / x) / 2.f;
+							if (CORR[s][t] >  1.f)
 							{
-								CORR[s][t] = -1.f;
+								CORR[s][t] = 1.f;
 								++pLevellingCount;
 							}
+							else
+							{
+								if (CORR[s][t] < -1.f)
+								{
+									CORR[s][t] = -1.f;
+									++pLevellingCount;
+								}
+							}
 						}
 					}
-				}
 
 				
-				CORR[s][s] = 1.f;
-			}
+					CORR[s][s] = 1.f;
+				}
 
 			
-			shrink = MatrixDPMake<float>(Triangle_courant, CORR, Carre_reference, pCorrMonth->entry, processCount, pQCHOLTotal);
-			if (shrink == -1.f)
-			{
+				shrink = MatrixDPMake<float>(Triangle_courant, CORR, Carre_reference, pCorrMonth->entry, processCount, pQCHOLTotal);
+				if (shrink == -1.f)
+				{
 				
-				logs.error() << "TS " << pTSName << " generator: invalid correlation matrix";
-				return false;
+					logs.error() << "TS " << pTSName << " generator: invalid correlation matrix";
+					return false;
+				}
+
+				cache = new float[processCount * processCount];
+				memcpy(cache, factor[0], sizeof(float) * processCount * processCount);
+				pMonthlyShrink[pRealMonth] = shrink;
+				pMonthlyLevellingCount[pRealMonth] = pLevellingCount - levellingCount;
+			}
+			else
+			{
+				memcpy(factor[0], cache, sizeof(float) * processCount * processCount);
+				shrink = pMonthlyShrink[pRealMonth];
+				pLevellingCount += pMonthlyLevellingCount[pRealMonth];
 			}
 			
 			Compteur_ndp = (shrink < 1.f) ? 100 : 0;
@@ -70,6 +70,16 @@ namespace XCast
 	}
 
 
+	void StudyData::shareFrom(const StudyData& other)
+	{
+		localareas = other.localareas;
+		for (uint realmonth = 0; realmonth != 12; ++realmonth)
+			correlation[realmonth] = other.correlation[realmonth];
+		// not the owner of the matrices
+		mode = Data::Correlation::modeNone;
+	}
+
+
 	void StudyData::prepareMatrix(Matrix<float>& m, const Matrix<float>& source) const
 	{
 		uint areaCount = (uint) localareas.size();
@@ -85,6 +85,13 @@ namespace XCast
 		template<class PredicateT>
 		void loadFromStudy(Data::Study& study, const Data::Correlation& correlation, PredicateT& predicate);
 
+		/*!
+		** \brief Use the areas and the correlation coefficients of another instance
+		**
+		** The correlation matrices remain owned by `other`, which must outlive this instance.
+		*/
+		void shareFrom(const StudyData& other);
+
 	public:
 		//! List of all areas (sub-set of the complete list)
 		Data::Area::Vector localareas;
@@ -35,6 +35,8 @@
 #include <yuni/io/directory.h>
 #include <antares/memory/memory.h>
 #include <antares/study/area/constants.h>
+#include <yuni/job/job.h>
+#include <yuni/job/queue/service.h>
 
 
 using namespace Yuni;
@@ -70,13 +72,28 @@ namespace XCast
 		study(study),
 		timeSeriesType(ts),
 		pNeverInitialized(true),
+		pNewSeries(true),
 		pAccuracyOnCorrelation(false)
-	{}
+	{
+		for (uint realmonth = 0; realmonth != 12; ++realmonth)
+			pMonthlyFactor[realmonth] = nullptr;
+	}
 
 
 	XCast::~XCast()
 	{
 		destroyTemporaryData();
+		releaseMonthlyFactors();
+	}
+
+
+	void XCast::releaseMonthlyFactors()
+	{
+		for (uint realmonth = 0; realmonth != 12; ++realmonth)
+		{
+			delete[] pMonthlyFactor[realmonth];
+			pMonthlyFactor[realmonth] = nullptr;
+		}
 	}
 
 
@@ -297,6 +314,28 @@ namespace XCast
 			}
 		};
 
+
+		template<class AllocatorT>
+		float** AllocateSquareMatrix(AllocatorT& m, uint p)
+		{
+			// A single buffer for all rows
+			float** rows = m.template allocate<float*>(p);
+			if (p != 0)
+			{
+				rows[0] = m.template allocate<float>(p * p);
+				for (uint i = 1; i != p; ++i)
+					rows[i] = rows[0] + i * p;
+			}
+			return rows;
+		}
+
+		void FreeSquareMatrix(float** rows, uint p)
+		{
+			if (p != 0)
+				delete[] rows[0];
+			delete[] rows;
+		}
+
 	} 
 
 
@@ -335,24 +374,18 @@ namespace XCast
 		Presque_mini = m.allocate<float>(p);
 		pQCHOLTotal  = m.allocate<float>(p);
 
-		CORR = m.allocate<float*>(p);
-		Triangle_reference = m.allocate<float*>(p);
-		Triangle_courant = m.allocate<float*>(p);
+		CORR = AllocateSquareMatrix(m, p);
+		Triangle_reference = AllocateSquareMatrix(m, p);
+		Triangle_courant = AllocateSquareMatrix(m, p);
 		FO = m.allocate<float*>(p);
 		LISS = m.allocate<float*>(p);
 		DATL = m.allocate<float*>(p);
 		DATA = m.allocate<float*>(p);
-		Carre_courant = m.allocate<float*>(p);
-		Carre_reference = m.allocate<float*>(p);
+		Carre_courant = AllocateSquareMatrix(m, p);
+		Carre_reference = AllocateSquareMatrix(m, p);
 
 		for (uint i = 0; i != p; ++i)
 		{
-			Triangle_reference[i] = m.allocate<float>(p);
-			Triangle_courant[i]   = m.allocate<float>(p);
-			Carre_courant[i]      = m.allocate<float>(p);
-			Carre_reference[i]    = m.allocate<float>(p);
-
-			CORR[i] = m.allocate<float>(p);
 			FO[i]   = m.allocate<float>(24);
 			LISS[i] = m.allocate<float>(24);
 			DATL[i] = m.allocate<float>(24);
@@ -368,25 +401,20 @@ namespace XCast
 			uint p = (uint) pData.localareas.size();
 			for (uint i = 0; i != p; ++i)
 			{
-				delete[] CORR[i];
 				delete[] FO[i];
 				delete[] LISS[i];
 				delete[] DATL[i];
-				delete[] Triangle_reference[i];
-				delete[] Triangle_courant[i];
 				delete[] DATA[i];
-				delete[] Carre_courant[i];
-				delete[] Carre_reference[i];
 			}
-			delete[] Carre_courant;
-			delete[] Carre_reference;
+			FreeSquareMatrix(Carre_courant, p);
+			FreeSquareMatrix(Carre_reference, p);
 			delete[] D_COPIE;
 			delete[] DATA;
-			delete[] Triangle_reference;
-			delete[] Triangle_courant;
+			FreeSquareMatrix(Triangle_reference, p);
+			FreeSquareMatrix(Triangle_courant, p);
 			delete[] LISS;
 			delete[] DATL;
-			delete[] CORR;
+			FreeSquareMatrix(CORR, p);
 			delete[] FO;
 			delete[] A;
 			delete[] B;
@@ -415,86 +443,75 @@ namespace XCast
 	}
 
 
-	template<class PredicateT>
-	bool XCast::runWithPredicate(PredicateT& predicate, Progression::Task& progression)
+	void XCast::prepareWorker(const XCast& master)
 	{
-		enum
-		{
-			
-			nbHoursADay = 24,
-		};
-
-		pTSName = predicate.timeSeriesName();
-
-		
-		{
-			logs.info(); 
-			logs.info() << "Generating the " << predicate.timeSeriesName() << " time-series";
-		}
+		assert(not master.pNeverInitialized);
+		pData.shareFrom(master.pData);
+		nbTimeseries = master.nbTimeseries;
+		year         = master.year;
+		random       = nullptr;
+		pTSName      = master.pTSName;
+		pAccuracyOnCorrelation = master.pAccuracyOnCorrelation;
+
+		allocateTemporaryData();
+		pNeverInitialized = false;
 		for (uint s = 0; s != pData.localareas.size(); ++s)
-		{
-			if (not predicate.preproDataIsReader(*pData.localareas[s]))
-			{
-				logs.warning() << "The timeseries will not be regenerated. All data related to the ts-generator for "
-					<< "'" << predicate.timeSeriesName() << "' have been released.";
-				return false;
-			}
-		}
+			pUseConversion[s] = master.pUseConversion[s];
 
-		if (pNeverInitialized)
-		{
-			
-			const uint nbHours = 8760;
-			
-			loadFromStudy(predicate.correlation(study), predicate);
-			
-			allocateTemporaryData();
+		pComputedPointCount = 0;
+		pNDPMatrixCount     = 0;
+		pLevellingCount     = 0;
+	}
 
-			for (uint s = 0; s != pData.localareas.size(); ++s)
-			{
-				
-				auto& area = *(pData.localareas[s]);
 
-				
-				predicate.matrix(area).resize(nbTimeseries, nbHours);
-				predicate.matrix(area).flush();
-				auto& xcast = predicate.xcastData(area);
-				
-				pUseConversion[s] = (xcast.useConversion && xcast.conversion.width >= 3);
-			}
-
-			pAccuracyOnCorrelation = ((study.parameters.timeSeriesAccuracyOnCorrelation & timeSeriesType) != 0);
+	template<class PredicateT>
+	class XCast::GenerationJob final : public Yuni::Job::IJob
+	{
+	public:
+		GenerationJob(XCast& xcast, PredicateT& predicate, Progression::Task& progression,
+			const std::vector<uint>& seeds, uint first, uint step) :
+			pXCast(xcast),
+			pPredicate(predicate),
+			pProgression(progression),
+			pSeeds(seeds),
+			pFirst(first),
+			pStep(step)
+		{}
+
+	private:
+		virtual void onExecute() override
+		{
+			pXCast.generateTimeSeries(pPredicate, pProgression, pSeeds, pFirst, pStep);
 		}
 
-		
-		const uint processCount = (uint) pData.localareas.size();
+	private:
+		XCast& pXCast;
+		PredicateT& pPredicate;
+		Progression::Task& pProgression;
+		const std::vector<uint>& pSeeds;
+		uint pFirst;
+		uint pStep;
+	};
 
-		
-		
-		
-		if (study.areas.size() > pData.localareas.size())
-			progression += (nbTimeseries * 365) * ((uint) study.areas.size() - (uint) pData.localareas.size());
 
-		if (processCount == 0)
+	template<class PredicateT>
+	void XCast::generateTimeSeries(PredicateT& predicate, Progression::Task& progression,
+		const std::vector<uint>& seeds, uint first, uint step)
+	{
+		enum
 		{
 			
-			if (study.parameters.timeSeriesToArchive & timeSeriesType)
-				exportTimeSeriesToTheOutput(progression, predicate);
-			return true;
-		}
-
-		
-		
-		updateMissingCoefficients(predicate);
+			nbHoursADay = 24,
+		};
 
 		
-		pComputedPointCount = 0;
-		pNDPMatrixCount     = 0;
-		pLevellingCount     = 0;
-
+		const uint processCount = (uint) pData.localareas.size();
 
-		for (uint tsIndex = 0; tsIndex != nbTimeseries; ++tsIndex)
+		for (uint tsIndex = first; tsIndex < nbTimeseries; tsIndex += step)
 		{
+			// A new time-series, with its own random stream
+			pRandom.reset(seeds[tsIndex]);
+			pNewSeries = true;
 			
 			uint hourInTheYear = 0;
 
@@ -510,6 +527,7 @@ namespace XCast
 				pNewMonth = true;
 				
 				pCorrMonth = pData.correlation[realmonth];
+				pRealMonth = realmonth;
 
 				
 				for (uint s = 0; s != processCount; ++s)
@@ -673,6 +691,137 @@ namespace XCast
 			}
 
 		} 
+	}
+
+
+	template<class PredicateT>
+	bool XCast::runWithPredicate(PredicateT& predicate, Progression::Task& progression)
+	{
+		enum
+		{
+			
+			nbHoursADay = 24,
+		};
+
+		pTSName = predicate.timeSeriesName();
+
+		
+		{
+			logs.info(); 
+			logs.info() << "Generating the " << predicate.timeSeriesName() << " time-series";
+		}
+		for (uint s = 0; s != pData.localareas.size(); ++s)
+		{
+			if (not predicate.preproDataIsReader(*pData.localareas[s]))
+			{
+				logs.warning() << "The timeseries will not be regenerated. All data related to the ts-generator for "
+					<< "'" << predicate.timeSeriesName() << "' have been released.";
+				return false;
+			}
+		}
+
+		if (pNeverInitialized)
+		{
+			
+			const uint nbHours = 8760;
+			
+			loadFromStudy(predicate.correlation(study), predicate);
+			
+			allocateTemporaryData();
+			pNeverInitialized = false;
+
+			for (uint s = 0; s != pData.localareas.size(); ++s)
+			{
+				
+				auto& area = *(pData.localareas[s]);
+
+				
+				predicate.matrix(area).resize(nbTimeseries, nbHours);
+				predicate.matrix(area).flush();
+				auto& xcast = predicate.xcastData(area);
+				
+				pUseConversion[s] = (xcast.useConversion && xcast.conversion.width >= 3);
+			}
+
+			pAccuracyOnCorrelation = ((study.parameters.timeSeriesAccuracyOnCorrelation & timeSeriesType) != 0);
+		}
+
+		
+		const uint processCount = (uint) pData.localareas.size();
+
+		
+		
+		
+		if (study.areas.size() > pData.localareas.size())
+			progression += (nbTimeseries * 365) * ((uint) study.areas.size() - (uint) pData.localareas.size());
+
+		if (processCount == 0)
+		{
+			
+			if (study.parameters.timeSeriesToArchive & timeSeriesType)
+				exportTimeSeriesToTheOutput(progression, predicate);
+			return true;
+		}
+
+		
+		
+		updateMissingCoefficients(predicate);
+
+		
+		pComputedPointCount = 0;
+		pNDPMatrixCount     = 0;
+		pLevellingCount     = 0;
+
+
+		// One random stream per time-series, seeded in the order of the time-series :
+		// the results do not depend on the number of threads
+		std::vector<uint> seeds(nbTimeseries);
+		for (uint tsIndex = 0; tsIndex != nbTimeseries; ++tsIndex)
+			seeds[tsIndex] = (uint) Math::Min(random->next() * 4294967295., 4294967295.); // next() lies in [0, 1]
+
+		if (not prepareCorrelationMatrices())
+			AntaresSolverEmergencyShutdown();
+		releaseMonthlyFactors();
+
+		uint nbThreads = Math::Max<uint>(1, study.maxNbYearsInParallel);
+		if (nbThreads > nbTimeseries)
+			nbThreads = Math::Max<uint>(1, nbTimeseries);
+		# ifdef ANTARES_SWAP_SUPPORT
+		// The workers would share the matrices of the study (coefficients, conversion,
+		// translation and series), which are flushed after each use : one worker only
+		nbThreads = 1;
+		# endif
+
+		if (nbThreads == 1)
+		{
+			generateTimeSeries(predicate, progression, seeds, 0, 1);
+		}
+		else
+		{
+			std::vector<XCast*> workers(nbThreads, nullptr);
+			workers[0] = this;
+			for (uint t = 1; t != nbThreads; ++t)
+			{
+				workers[t] = new XCast(study, timeSeriesType);
+				workers[t]->prepareWorker(*this);
+			}
+
+			Job::QueueService qs;
+			qs.maximumThreadCount(nbThreads);
+			qs.start();
+			for (uint t = 0; t != nbThreads; ++t)
+				qs.add(new GenerationJob<PredicateT>(*(workers[t]), predicate, progression, seeds, t, nbThreads));
+			qs.wait(Yuni::qseIdle);
+			qs.stop();
+
+			for (uint t = 1; t != nbThreads; ++t)
+			{
+				pComputedPointCount += workers[t]->pComputedPointCount;
+				pNDPMatrixCount     += workers[t]->pNDPMatrixCount;
+				pLevellingCount     += workers[t]->pLevellingCount;
+				delete workers[t];
+			}
+		}
 
 
 
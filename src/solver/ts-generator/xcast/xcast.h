@@ -32,6 +32,7 @@
 # include <antares/mersenne-twister/mersenne-twister.h>
 # include "studydata.h"
 # include <yuni/core/noncopyable.h>
+# include <vector>
 
 
 namespace Antares
@@ -109,17 +110,48 @@ namespace XCast
 		//! The time-series type
 		const Data::TimeSeries timeSeriesType;
 
-		//! The random generator to use
+		//! The random generator to use (seeds of the time-series)
 		MersenneTwister* random;
 
 
 	private:
 		void allocateTemporaryData();
 		void destroyTemporaryData();
+		//! Release the decompositions of the correlation matrices of each month
+		void releaseMonthlyFactors();
 
 		template<class PredicateT> void updateMissingCoefficients(PredicateT& predicate);
 		template<class PredicateT> bool runWithPredicate(PredicateT& predicate, Progression::Task& progression);
 
+		/*!
+		** \brief Generate the time-series first, first + step, ...
+		**
+		** Each time-series starts from the expectation of the processes and has
+		** its own random stream, initialized from `seeds`. Thus the time-series
+		** can be generated by several instances simultaneously (see prepareWorker()).
+		*/
+		template<class PredicateT>
+		void generateTimeSeries(PredicateT& predicate, Progression::Task& progression,
+			const std::vector<uint>& seeds, uint first, uint step);
+
+		/*!
+		** \brief Prepare this instance to generate some time-series on behalf of another one
+		**
+		** The temporary data are allocated, the study data are shared with `master`.
+		*/
+		void prepareWorker(const XCast& master);
+
+		/*!
+		** \brief Make sure the Cholesky factorization of the correlation matrices succeeds
+		**
+		** The correlation coefficients are slightly reduced if required.
+		** \return False if a correlation matrix is invalid
+		*/
+		bool prepareCorrelationMatrices();
+
+		//! Job for generating some time-series (see generateTimeSeries())
+		template<class PredicateT> class GenerationJob;
+
 		/*!
 		** \brief Export all time-series for each process into the output folder
 		*/
@@ -178,8 +210,25 @@ namespace XCast
 
 		//! The correlation matrix for the current month
 		const Matrix<float>* pCorrMonth;
+		//! The current real month
+		uint pRealMonth;
+
+		/*!
+		** \brief Decomposition of the correlation matrix of each month (p x p, row-major)
+		**
+		** They do not depend on the time-series and are computed only once :
+		** Triangle_courant, or Carre_reference when the accuracy on the
+		** correlation is required (see generateValuesForTheCurrentDay()).
+		*/
+		float* pMonthlyFactor[12];
+		//! Shrink coefficient of the correlation matrix of each month
+		float pMonthlyShrink[12];
+		//! Number of levellings of the correlation coefficients of each month
+		uint pMonthlyLevellingCount[12];
 
 		bool pNeverInitialized;
+		//! True when starting a new time-series (the processes must be reinitialized)
+		bool pNewSeries;
 		uint Nombre_points_intermediaire;
 
 		//! True when starting a new month (some data may have to be reinitialized)
@@ -223,6 +272,7 @@ namespace XCast
 		float* WIEN;
 		float* BROW;
 
+		// p x p matrices, stored in a contiguous row-major buffer
 		float** Triangle_reference;
 		float** Triangle_courant;
 		float** Carre_reference;
@@ -241,6 +291,9 @@ namespace XCast
 		//! Name of the current timeseries
 		Yuni::CString<32,false> pTSName;
 
+		//! The random generator of the current time-series
+		MersenneTwister pRandom;
+
 	}; // class XCast
 
 
@@ -100,6 +100,8 @@ namespace Variable
 			n.initializeFromStudy(study);
 			// From the area
 			n.initializeFromArea(&study, currentArea);
+			// Output filters
+			n.applySynthesisFilter(currentArea->filterSynthesis);
 
 			// It is needed that the whole memory is flushed to swap
 			// Some intermediate are not flush and it may lead
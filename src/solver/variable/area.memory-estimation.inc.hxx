@@ -59,6 +59,8 @@ namespace Variable
 		for (auto area = u.study.areas.begin(); area != end; ++area)
 		{
 			u.area = area->second;
+			u.hourlySynthesis = (0 != (u.area->filterSynthesis & Data::filterHourly))
+				or not u.study.parameters.filtering;
 
 			u.requiredMemoryForOutput += sizeof(NextType) + sizeof(void*) /*overhead vector*/;
 			u.overheadDiskSpaceForSingleAreaOrLink();
@@ -76,6 +78,7 @@ namespace Variable
 			NextType::EstimateMemoryUsage(u);
 		}
 		u.area = nullptr;
+		u.hourlySynthesis = true;
 	}
 
 
@@ -78,6 +78,8 @@ namespace LINK_NAMESPACE
 				n.initializeFromArea(study, area);
 				// From the link
 				n.initializeFromAreaLink(study, i->second);
+				// Output filters
+				n.applySynthesisFilter(i->second->filterSynthesis);
 
 				// Flush all memory into the swap files
 				// (only if the support is available)
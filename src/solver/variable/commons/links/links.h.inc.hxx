@@ -132,6 +132,7 @@ namespace LINK_NAMESPACE
 		void initializeFromArea(Data::Study*, Data::Area*);
 		void initializeFromThermalCluster(Data::Study*, Data::Area*, Data::ThermalCluster*);
 		void initializeFromAreaLink(Data::Study*, Data::AreaLink*);
+		void applySynthesisFilter(uint);
 
 
 		void simulationBegin();
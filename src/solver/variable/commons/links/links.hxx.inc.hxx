@@ -62,6 +62,13 @@ namespace LINK_NAMESPACE
 	{
 		// This method should not be called at this stage
 	}
+
+
+	inline void Links::applySynthesisFilter(uint)
+	{
+		// Nothing to do here
+		// The filter of each link is applied by initializeFromArea()
+	}
 	
 	inline void Links::yearBegin(uint year, unsigned int numSpace)
 	{
@@ -318,11 +325,14 @@ namespace LINK_NAMESPACE
 		if (!u.area)
 			return;
 
-		// The total number of items
-		auto count = (uint) u.area->links.size();
+		const bool hourlySynthesis = u.hourlySynthesis;
 
-		for (uint i = 0; i != count; ++i)
+		auto end = u.area->links.end();
+		for (auto lnk = u.area->links.begin(); lnk != end; ++lnk)
 		{
+			u.hourlySynthesis = (0 != (lnk->second->filterSynthesis & Data::filterHourly))
+				or not u.study.parameters.filtering;
+
 			u.requiredMemoryForOutput  += sizeof(NextType) + sizeof(void*);
 			u.overheadDiskSpaceForSingleAreaOrLink();
 
@@ -340,6 +350,7 @@ namespace LINK_NAMESPACE
 			// the links
 			NextType::EstimateMemoryUsage(u);
 		}
+		u.hourlySynthesis = hourlySynthesis;
 	}
 
 
@@ -239,8 +239,8 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{			
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
-				AncestorType::pResults.merge(0, pValuesForTheCurrentYear[numSpace]);
+			for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
+				AncestorType::pResults.merge(0, pValuesForTheCurrentYear[it->first]);
 			
 			// Next variable
 			NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
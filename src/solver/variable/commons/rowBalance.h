@@ -113,6 +113,8 @@ namespace Economy
 		{
 			//! How many items have we got
 			count = 1 + NextT::count,
+			//! The hourly average is used by the spatial aggregates (once)
+			hourlySynthesisRequired = 1,
 		};
 
 		template<int CDataLevel, int CFile>
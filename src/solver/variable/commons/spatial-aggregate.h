@@ -419,12 +419,12 @@ namespace Common
 		{
 			typedef typename VCardType::VCardOrigin  VCardOrigin;
 			
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
 			{
 				// Merge all those values with the global results
-				VariableAccessorType::ComputeSummary(	pValuesForTheCurrentYear[numSpace],
+				VariableAccessorType::ComputeSummary(	pValuesForTheCurrentYear[it->first],
 														AncestorType::pResults,
-														numSpaceToYear[numSpace]	);
+														it->second	);
 			}
 		}
 
@@ -70,6 +70,16 @@ namespace Variable
 		}
 	}
 
+	/*!
+	** \brief Get the number of decimals from a printf format (see AssignPrecisionToPrintfFormat)
+	*/
+	template<class StringT>
+	static inline uint PrintfFormatToPrecision(const StringT& format)
+	{
+		return (format.size() == 4 and format[2] >= '0' and format[2] <= '9')
+			? (uint)(format[2] - '0') : 6;
+	}
+
 
 
 
@@ -143,8 +143,14 @@ namespace Container
 		** aggragations.
 		** \param year The current year
 		*/
-		void yearEnd(unsigned int year, unsigned int numSpace);	
+		void yearEnd(unsigned int year, unsigned int numSpace);
 
+		/*!
+		** \brief Merge the results of the given years into the synthesis
+		**
+		** Only the spaces present in the map are merged (numSpace -> year).
+		** The caller is responsible for the merge order across calls.
+		*/
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary);
 
 		template<class V>
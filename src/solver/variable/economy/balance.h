@@ -114,6 +114,8 @@ namespace Economy
 		{
 			//! How many items have we got
 			count = 1 + NextT::count,
+			//! The hourly average is used by the quadratic optimisation
+			hourlySynthesisRequired = 1,
 		};
 
 		template<int CDataLevel, int CFile>
@@ -240,10 +242,10 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
 			{
 				// Merge all those values with the global results
-				AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/, pValuesForTheCurrentYear[numSpace]);
+				AncestorType::pResults.merge(it->second /*year*/, pValuesForTheCurrentYear[it->first]);
 			}
 			
 			// Next variable
@@ -254,11 +254,11 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
 				VariableAccessorType::ComputeSummary(	
-														pValuesForTheCurrentYear[numSpace], 
+														pValuesForTheCurrentYear[it->first], 
 														AncestorType::pResults, 
-														numSpaceToYear[numSpace]
+														it->second
 													);
 			// Next variable
 			NextType::computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
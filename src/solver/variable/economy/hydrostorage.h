@@ -229,10 +229,10 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
 			{
 				// Merge all those values with the global results
-				AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/, pValuesForTheCurrentYear[numSpace]);
+				AncestorType::pResults.merge(it->second /*year*/, pValuesForTheCurrentYear[it->first]);
 			}
 			
 			// Next variable
@@ -247,15 +247,20 @@ namespace Economy
 
 		void hourForEachArea(State& state, unsigned int numSpace)
 		{
-			// Total HydroStorage emissions
-			pValuesForTheCurrentYear[numSpace].hour[state.hourInTheYear] =
-				// Current Hydro Storage generation
-				state.hourlyResults->TurbinageHoraire[state.hourInTheWeek];
-
 			// Next variable
 			NextType::hourForEachArea(state, numSpace);
 		}
 
+		void weekForEachArea(State& state, unsigned int numSpace)
+		{
+			// Total HydroStorage generation, for the whole week at once
+			double* values = Memory::RawPointer(pValuesForTheCurrentYear[numSpace].hour) + state.hourInTheYear;
+			memcpy(values, state.hourlyResults->TurbinageHoraire, sizeof(double) * maxHoursInAWeek);
+
+			// Next variable
+			NextType::weekForEachArea(state, numSpace);
+		}
+
 		void hourForEachThermalCluster(State& state, unsigned int numSpace)
 		{
 			// Next item in the list
@@ -253,12 +253,12 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
 			{
 				for (uint i = 0; i != VCardType::columnCount; ++i)
 				{
 					// Merge all those values with the global results
-					AncestorType::pResults[i].merge(numSpaceToYear[numSpace], pValuesForTheCurrentYear[numSpace][i]);
+					AncestorType::pResults[i].merge(it->second, pValuesForTheCurrentYear[it->first][i]);
 				}
 			}
 
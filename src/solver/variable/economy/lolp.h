@@ -223,10 +223,10 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
 			{
 				// Merge all those values with the global results
-				AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/, pValuesForTheCurrentYear[numSpace]);
+				AncestorType::pResults.merge(it->second /*year*/, pValuesForTheCurrentYear[it->first]);
 			}
 			
 			// Next variable
@@ -241,14 +241,25 @@ namespace Economy
 
 		void hourForEachArea(State& state, unsigned int numSpace)
 		{
-			// LOLP
-			if (state.hourlyResults->ValeursHorairesDeDefaillancePositive[state.hourInTheWeek] > 0.)
-				pValuesForTheCurrentYear[numSpace][state.hourInTheYear] = 100;
-
 			// Next variable
 			NextType::hourForEachArea(state, numSpace);
 		}
 
+		void weekForEachArea(State& state, unsigned int numSpace)
+		{
+			// LOLP, for the whole week at once
+			double* values = Memory::RawPointer(pValuesForTheCurrentYear[numSpace].hour) + state.hourInTheYear;
+			const double* unsupplied = state.hourlyResults->ValeursHorairesDeDefaillancePositive;
+			for (uint hw = 0; hw != maxHoursInAWeek; ++hw)
+			{
+				if (unsupplied[hw] > 0.)
+					values[hw] = 100;
+			}
+
+			// Next variable
+			NextType::weekForEachArea(state, numSpace);
+		}
+
 		void hourForEachThermalCluster(State& state, unsigned int numSpace)
 		{
 			// Next item in the list
@@ -55,7 +55,8 @@ namespace Economy
 			R::AllYears::StdDeviation< // The standard deviation values throughout all years
 			R::AllYears::Min<          // The minimum values thoughout all years
 			R::AllYears::Max<          // The maximum values thoughout all years
-			> > > > >  ResultsType;
+			R::AllYears::Quantiles<    // The quantiles P10, P50, P90 throughout all years
+			> > > > > >  ResultsType;
 
 		//! The VCard to look for for calculating spatial aggregates
 		typedef VCardPrice VCardForSpatialAggregate;
@@ -228,10 +229,10 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
 			{
 				// Merge all those values with the global results
-				AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/, pValuesForTheCurrentYear[numSpace]);
+				AncestorType::pResults.merge(it->second /*year*/, pValuesForTheCurrentYear[it->first]);
 			}
 			
 			// Next variable
@@ -246,13 +247,22 @@ namespace Economy
 
 		void hourForEachArea(State& state, unsigned int numSpace)
 		{
-			// Marginal Price
+			// Next variable
+			NextType::hourForEachArea(state, numSpace);
+		}
+
+		void weekForEachArea(State& state, unsigned int numSpace)
+		{
+			// Marginal Price, for the whole week at once
 			// Note: The marginal price provided by the solver is negative
 			// (naming convention).
-			pValuesForTheCurrentYear[numSpace][state.hourInTheYear] -=
-				state.hourlyResults->CoutsMarginauxHoraires[state.hourInTheWeek];
+			double* values = Memory::RawPointer(pValuesForTheCurrentYear[numSpace].hour) + state.hourInTheYear;
+			const double* price = state.hourlyResults->CoutsMarginauxHoraires;
+			for (uint hw = 0; hw != maxHoursInAWeek; ++hw)
+				values[hw] -= price[hw];
+
 			// Next variable
-			NextType::hourForEachArea(state, numSpace);
+			NextType::weekForEachArea(state, numSpace);
 		}
 
 		void hourForEachThermalCluster(State& state, unsigned int numSpace)
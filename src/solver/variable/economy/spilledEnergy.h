@@ -230,10 +230,10 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
 			{
 				// Merge all those values with the global results
-				AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/, pValuesForTheCurrentYear[numSpace]);
+				AncestorType::pResults.merge(it->second /*year*/, pValuesForTheCurrentYear[it->first]);
 			}
 			
 			// Next variable
@@ -247,15 +247,21 @@ namespace Economy
 		}
 
 		void hourForEachArea(State& state, unsigned int numSpace)
+		{
+			// Next variable
+			NextType::hourForEachArea(state, numSpace);
+		}
+
+		void weekForEachArea(State& state, unsigned int numSpace)
 		{
 			assert(state.hourlyResults && "Invalid pointer to simplex results");
 
-			// Total SpilledEnergy emissions
-			pValuesForTheCurrentYear[numSpace][state.hourInTheYear] =
-				state.hourlyResults->ValeursHorairesDeDefaillanceNegative[state.hourInTheWeek];
+			// Total SpilledEnergy, for the whole week at once
+			double* values = Memory::RawPointer(pValuesForTheCurrentYear[numSpace].hour) + state.hourInTheYear;
+			memcpy(values, state.hourlyResults->ValeursHorairesDeDefaillanceNegative, sizeof(double) * maxHoursInAWeek);
 
 			// Next variable
-			NextType::hourForEachArea(state, numSpace);
+			NextType::weekForEachArea(state, numSpace);
 		}
 
 		void hourForEachThermalCluster(State& state, unsigned int numSpace)
@@ -54,7 +54,8 @@ namespace Economy
 			R::AllYears::StdDeviation< // The standard deviation values throughout all years
 			R::AllYears::Min<          // The minimum values throughout all years
 			R::AllYears::Max<          // The maximum values throughout all years
-			> > > > >  ResultsType;
+			R::AllYears::Quantiles<    // The quantiles P10, P50, P90 throughout all years
+			> > > > > >  ResultsType;
 
 		//! The VCard to look for for calculating spatial aggregates
 		typedef VCardUnsupliedEnergy  VCardForSpatialAggregate;
@@ -229,10 +230,10 @@ namespace Economy
 
 		void computeSummary(std::map<unsigned int, unsigned int> & numSpaceToYear, unsigned int nbYearsForCurrentSummary)
 		{
-			for (unsigned int numSpace = 0; numSpace < nbYearsForCurrentSummary; ++numSpace)
+			for (auto it = numSpaceToYear.begin(); it != numSpaceToYear.end(); ++it)
 			{
 				// Merge all those values with the global results
-				AncestorType::pResults.merge(numSpaceToYear[numSpace] /*year*/, pValuesForTheCurrentYear[numSpace]);
+				AncestorType::pResults.merge(it->second /*year*/, pValuesForTheCurrentYear[it->first]);
 			}
 			
 			// Next variable
@@ -247,15 +248,20 @@ namespace Economy
 
 		void hourForEachArea(State& state, unsigned int numSpace)
 		{
-			// Total UnsupliedEnergy emissions
-			pValuesForTheCurrentYear[numSpace][state.hourInTheYear] =
-				// Current Hydro Storage generation
-				state.hourlyResults->ValeursHorairesDeDefaillancePositive[state.hourInTheWeek];
-
 			// Next variable
 			NextType::hourForEachArea(state, numSpace);
 		}
 
+		void weekForEachArea(State& state, unsigned int numSpace)
+		{
+			// Total UnsupliedEnergy, for the whole week at once
+			double* values = Memory::RawPointer(pValuesForTheCurrentYear[numSpace].hour) + state.hourInTheYear;
+			memcpy(values, state.hourlyResults->ValeursHorairesDeDefaillancePositive, sizeof(double) * maxHoursInAWeek);
+
+			// Next variable
+			NextType::weekForEachArea(state, numSpace);
+		}
+
 		void hourForEachThermalCluster(State& state, unsigned int numSpace)
 		{
 			// Next item in the list
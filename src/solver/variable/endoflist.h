@@ -83,6 +83,7 @@ namespace Container
 		static void initializeFromArea(Data::Study*, Data::Area*) {}
 		static void initializeFromThermalCluster(Data::Study*, Data::Area*, Data::ThermalCluster*) {}
 		static void initializeFromAreaLink(Data::Study*, Data::AreaLink*) {}
+		static void applySynthesisFilter(uint) {}
 
 		static void simulationBegin() {}
 
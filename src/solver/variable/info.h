@@ -129,6 +129,13 @@ namespace Variable
 				out[i].reset();
 		}
 
+		template<class U>
+		static void ReleaseHourlyValues(U& out)
+		{
+			for (uint i = 0; i != ColumnCountT; ++i)
+				out[i].releaseHourlyValues();
+		}
+
 
 		template<class VCardT, class U>
 		static void ComputeStatistics(U& intermediateValues, uint year)
@@ -303,6 +310,12 @@ namespace Variable
 				(*i).reset();
 		}
 
+		template<class U> static void ReleaseHourlyValues(U& out)
+		{
+			for (uint i = 0; i != out.size(); ++i)
+				out[i].releaseHourlyValues();
+		}
+
 
 		template<class VCardT, class U>
 		static void ComputeStatistics(U& intermediateValues, uint year)
@@ -461,6 +474,12 @@ namespace Variable
 			out.reset();
 		}
 
+		template<class U>
+		static void ReleaseHourlyValues(U& out)
+		{
+			out.releaseHourlyValues();
+		}
+
 
 		template<class VCardT, class U>
 		static void ComputeStatistics(U& intermediateValues, uint year)
@@ -582,6 +601,11 @@ namespace Variable
 			// Do nothing
 		}
 
+		template<class U> static void ReleaseHourlyValues(U&)
+		{
+			// Do nothing
+		}
+
 		template<class VCardT, class U>
 		static void ComputeStatisticsAndMerge(U&, Type&, uint)
 		{
@@ -100,6 +100,13 @@ namespace AllYears
 			NextType::reset();
 		}
 
+		void releaseHourlyValues()
+		{
+			Antares::Memory::Release(andHourly);
+			// Next
+			NextType::releaseHourlyValues();
+		}
+
 		void merge(uint year, const IntermediateValues& rhs)
 		{
 			// Next
@@ -167,7 +174,8 @@ namespace AllYears
 
 		static void EstimateMemoryUsage(Antares::Data::StudyMemoryUsage& u)
 		{
-			Antares::Memory::EstimateMemoryUsage(sizeof(double), maxHoursInAYear, u, false);
+			if (u.hourlySynthesis)
+				Antares::Memory::EstimateMemoryUsage(sizeof(double), maxHoursInAYear, u, false);
 			u.takeIntoConsiderationANewTimeserieForDiskOutput();
 			NextType::EstimateMemoryUsage(u);
 		}
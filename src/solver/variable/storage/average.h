@@ -96,6 +96,13 @@ namespace AllYears
 			NextType::reset();
 		}
 
+		void releaseHourlyValues()
+		{
+			avgdata.releaseHourlyValues();
+			// Next
+			NextType::releaseHourlyValues();
+		}
+
 		void merge(uint year, const IntermediateValues& rhs)
 		{
 			avgdata.merge(year, rhs);
@@ -177,7 +184,8 @@ namespace AllYears
 
 		static void EstimateMemoryUsage(Antares::Data::StudyMemoryUsage& u)
 		{
-			Antares::Memory::EstimateMemoryUsage(sizeof(double), maxHoursInAYear, u, false);
+			if (u.hourlySynthesis)
+				Antares::Memory::EstimateMemoryUsage(sizeof(double), maxHoursInAYear, u, false);
 			u.requiredMemoryForOutput += u.years * sizeof(double);
 			u.takeIntoConsiderationANewTimeserieForDiskOutput();
 			NextType::EstimateMemoryUsage(u);
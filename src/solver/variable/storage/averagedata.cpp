@@ -63,7 +63,8 @@ namespace AllYears
 
 	void AverageData::reset()
 	{
-		Antares::Memory::Zero(maxHoursInAYear, hourly);
+		if (hourly)
+			Antares::Memory::Zero(maxHoursInAYear, hourly);
 		(void)::memset(monthly, 0, sizeof(double) * maxMonths);
 		(void)::memset(weekly,  0, sizeof(double) * maxWeeksInAYear);
 		(void)::memset(daily,   0, sizeof(double) * maxDaysInAYear);
@@ -79,12 +80,21 @@ namespace AllYears
 	}
 
 
+	void AverageData::releaseHourlyValues()
+	{
+		Antares::Memory::Release(hourly);
+	}
+
+
 	void AverageData::merge(unsigned int y, const IntermediateValues& rhs)
 	{
 		unsigned int i;
 		// Average value for each hour throughout all years
-		for (i = 0; i != maxHoursInAYear; ++i)
-			hourly[i] += rhs.hour[i] * ratio;
+		if (hourly)
+		{
+			for (i = 0; i != maxHoursInAYear; ++i)
+				hourly[i] += rhs.hour[i] * ratio;
+		}
 		// Average value for each day throughout all years
 		for (i = 0; i != maxDaysInAYear; ++i)
 			daily[i] += rhs.day[i] * ratio;
@@ -57,6 +57,11 @@ namespace AllYears
 
 		void initializeFromStudy(Data::Study& study);
 
+		/*!
+		** \brief Release the hourly values (hourly results not printed)
+		*/
+		void releaseHourlyValues();
+
 		void reset();
 
 		void merge(unsigned int year, const IntermediateValues& rhs);
@@ -59,6 +59,11 @@ namespace Variable
 			// Does nothing
 		}
 
+		static void releaseHourlyValues()
+		{
+			// Does nothing
+		}
+
 		static void merge(unsigned int /*year*/, const IntermediateValues& /*rhs*/)
 		{
 			// Does nothing
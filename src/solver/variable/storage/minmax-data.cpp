@@ -198,7 +198,8 @@ namespace AllYears
 		ArrayInitializer<maxMonths,       true>::Init(monthly);
 		ArrayInitializer<maxWeeksInAYear, true>::Init(weekly);
 		ArrayInitializer<maxDaysInAYear,  true>::Init(daily);
-		ArrayInitializer<maxHoursInAYear, true>::Init(hourly);
+		if (hourly)
+			ArrayInitializer<maxHoursInAYear, true>::Init(hourly);
 	}
 
 	void MinMaxData::resetSup()
@@ -207,7 +208,8 @@ namespace AllYears
 		ArrayInitializer<maxMonths,       false>::Init(monthly);
 		ArrayInitializer<maxWeeksInAYear, false>::Init(weekly);
 		ArrayInitializer<maxDaysInAYear,  false>::Init(daily);
-		ArrayInitializer<maxHoursInAYear, false>::Init(hourly);
+		if (hourly)
+			ArrayInitializer<maxHoursInAYear, false>::Init(hourly);
 	}
 
 
@@ -218,12 +220,19 @@ namespace AllYears
 	}
 
 
+	void MinMaxData::releaseHourlyValues()
+	{
+		Antares::Memory::Release(hourly);
+	}
+
+
 	void MinMaxData::mergeInf(uint year, const IntermediateValues& rhs)
 	{
 		MergeArray<true, maxMonths       >::Do (year, monthly, rhs.month);
 		MergeArray<true, maxWeeksInAYear >::Do (year, weekly,  rhs.week);
 		MergeArray<true, maxDaysInAYear  >::Do (year, daily,   rhs.day);
-		MergeArray<true, maxHoursInAYear >::Do (year, hourly,  rhs.hour);
+		if (hourly)
+			MergeArray<true, maxHoursInAYear >::Do (year, hourly,  rhs.hour);
 		MergeArray<true, 1               >::Do (year, &annual, &rhs.year);
 	}
 
@@ -233,7 +242,8 @@ namespace AllYears
 		MergeArray<false, maxMonths       >::Do (year, monthly, rhs.month);
 		MergeArray<false, maxWeeksInAYear >::Do (year, weekly,  rhs.week);
 		MergeArray<false, maxDaysInAYear  >::Do (year, daily,   rhs.day);
-		MergeArray<false, maxHoursInAYear >::Do (year, hourly,  rhs.hour);
+		if (hourly)
+			MergeArray<false, maxHoursInAYear >::Do (year, hourly,  rhs.hour);
 		MergeArray<false, 1               >::Do (year, &annual, &rhs.year);
 	}
 
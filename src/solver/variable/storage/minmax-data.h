@@ -64,6 +64,8 @@ namespace AllYears
 
 
 		void initialize();
+		//! Release the hourly values (hourly results not printed)
+		void releaseHourlyValues();
 
 		void resetInf();
 		void resetSup();
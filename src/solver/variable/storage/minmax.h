@@ -134,6 +134,8 @@ namespace AllYears
 
 		void reset();
 
+		void releaseHourlyValues();
+
 		void merge(uint year, const IntermediateValues& rhs);
 
 		void mergeHourInYear(uint year, uint hour, const double value);
@@ -152,7 +154,8 @@ namespace AllYears
 
 		static void EstimateMemoryUsage(Data::StudyMemoryUsage& u)
 		{
-			Antares::Memory::EstimateMemoryUsage(sizeof(MinMaxData::Data), maxHoursInAYear, u, false);
+			if (u.hourlySynthesis)
+				Antares::Memory::EstimateMemoryUsage(sizeof(MinMaxData::Data), maxHoursInAYear, u, false);
 			u.takeIntoConsiderationANewTimeserieForDiskOutput(true);
 			NextType::EstimateMemoryUsage(u);
 
@@ -63,6 +63,15 @@ namespace AllYears
 	}
 
 
+	template<bool OpInferior, class NextT>
+	inline void MinMaxBase<OpInferior,NextT>::releaseHourlyValues()
+	{
+		minmax.releaseHourlyValues();
+		// Next
+		NextType::releaseHourlyValues();
+	}
+
+
 	template<bool OpInferior, class NextT>
 	inline void
 	MinMaxBase<OpInferior,NextT>::mergeHourInYear(uint year, uint hour, const double value)
@@ -67,10 +67,17 @@ namespace AllYears
 	}
 
 
+	void OrData::releaseHourlyValues()
+	{
+		Antares::Memory::Release(hourly);
+	}
+
+
 	void OrData::reset()
 	{
 		// Reset
-		Antares::Memory::Zero(maxHoursInAYear, hourly);
+		if (hourly)
+			Antares::Memory::Zero(maxHoursInAYear, hourly);
 		(void)::memset(monthly, 0, sizeof(double) * maxMonths);
 		(void)::memset(weekly,  0, sizeof(double) * maxWeeksInAYear);
 		(void)::memset(daily,   0, sizeof(double) * maxDaysInAYear);
@@ -81,8 +88,11 @@ namespace AllYears
 	void OrData::merge(unsigned int y, const IntermediateValues& rhs)
 	{
 		unsigned int i;
-		for (i = 0; i != maxHoursInAYear; ++i)
-			hourly[i] += rhs.hour[i] * pRatio;
+		if (hourly)
+		{
+			for (i = 0; i != maxHoursInAYear; ++i)
+				hourly[i] += rhs.hour[i] * pRatio;
+		}
 		for (i = 0; i != maxDaysInAYear; ++i)
 			daily[i] += rhs.day[i] * pRatio;
 		for (i = 0; i != maxWeeksInAYear; ++i)
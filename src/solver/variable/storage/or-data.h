@@ -59,6 +59,8 @@ namespace AllYears
 
 	public:
 		void initializeFromStudy(const Data::Study& study);
+		//! Release the hourly values (hourly results not printed)
+		void releaseHourlyValues();
 		void reset();
 		void merge(unsigned int year, const IntermediateValues& rhs);
 
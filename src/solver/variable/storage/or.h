@@ -86,6 +86,13 @@ namespace AllYears
 			NextType::reset();
 		}
 
+		inline void releaseHourlyValues()
+		{
+			ordata.releaseHourlyValues();
+			// Next
+			NextType::releaseHourlyValues();
+		}
+
 		inline void merge(unsigned int year, const IntermediateValues& rhs)
 		{
 			ordata.merge(year, rhs);
@@ -182,7 +189,8 @@ namespace AllYears
 		static void EstimateMemoryUsage(Antares::Data::StudyMemoryUsage& u)
 		{
 			u.requiredMemoryForOutput += sizeof(double) * u.years;
-			Antares::Memory::EstimateMemoryUsage(sizeof(double), maxHoursInAYear, u, false);
+			if (u.hourlySynthesis)
+				Antares::Memory::EstimateMemoryUsage(sizeof(double), maxHoursInAYear, u, false);
 			u.takeIntoConsiderationANewTimeserieForDiskOutput();
 			NextType::EstimateMemoryUsage(u);
 		}
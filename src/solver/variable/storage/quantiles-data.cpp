@@ -0,0 +1,259 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+
+#include <yuni/yuni.h>
+#include <antares/study/memory-usage.h>
+#include "intermediate.h"
+#include "quantiles-data.h"
+#include <algorithm>
+
+
+using namespace Yuni;
+
+
+
+namespace Antares
+{
+namespace Solver
+{
+namespace Variable
+{
+namespace R
+{
+namespace AllYears
+{
+
+	namespace // anonymous
+	{
+
+		enum
+		{
+			nbMarkers = QuantilesData::nbMarkers,
+			nbQuantiles = QuantilesData::nbQuantiles,
+		};
+
+
+		/*!
+		** \brief Add a new value to the markers of a single quantile
+		**
+		** \param count The number of values already added
+		*/
+		void Insert(QuantilesData::Estimator& e, double p, uint count, double x)
+		{
+			double* h = e.height;
+
+			if (count < (uint) nbMarkers)
+			{
+				// Not enough values yet, they are simply kept
+				h[count] = x;
+				if (count + 1 == (uint) nbMarkers)
+				{
+					std::sort(h, h + nbMarkers);
+					e.position[0] = 2;
+					e.position[1] = 3;
+					e.position[2] = 4;
+				}
+				return;
+			}
+
+			double n[nbMarkers] =
+			{
+				1., (double) e.position[0], (double) e.position[1], (double) e.position[2], (double) count
+			};
+
+			// The cell k such as h[k] <= x < h[k + 1]
+			uint k;
+			if (x < h[0])
+			{
+				h[0] = x;
+				k = 0;
+			}
+			else if (x >= h[nbMarkers - 1])
+			{
+				h[nbMarkers - 1] = x;
+				k = nbMarkers - 2;
+			}
+			else
+			{
+				k = 0;
+				while (x >= h[k + 1])
+					++k;
+			}
+
+			// The markers above the new value are shifted
+			for (uint i = k + 1; i != (uint) nbMarkers; ++i)
+				n[i] += 1.;
+
+			// Desired positions of the inner markers
+			const double last = (double) count; // the total number of values, minus one
+			const double desired[nbMarkers - 2] =
+			{
+				1. + last * p * 0.5,
+				1. + last * p,
+				1. + last * (1. + p) * 0.5
+			};
+
+			for (uint i = 1; i != (uint) nbMarkers - 1; ++i)
+			{
+				const double d = desired[i - 1] - n[i];
+				if ((d >= 1. and n[i + 1] - n[i] > 1.) or (d <= -1. and n[i - 1] - n[i] < -1.))
+				{
+					const double s = (d > 0.) ? 1. : -1.;
+
+					// Parabolic prediction
+					const double hp = h[i] + s / (n[i + 1] - n[i - 1])
+						* ((n[i] - n[i - 1] + s) * (h[i + 1] - h[i]) / (n[i + 1] - n[i])
+						+ (n[i + 1] - n[i] - s) * (h[i] - h[i - 1]) / (n[i] - n[i - 1]));
+
+					if (h[i - 1] < hp and hp < h[i + 1])
+						h[i] = hp;
+					else
+					{
+						// Linear prediction otherwise
+						const uint j = (s > 0.) ? i + 1 : i - 1;
+						h[i] += s * (h[j] - h[i]) / (n[j] - n[i]);
+					}
+					n[i] += s;
+				}
+			}
+
+			e.position[0] = (Yuni::uint32) n[1];
+			e.position[1] = (Yuni::uint32) n[2];
+			e.position[2] = (Yuni::uint32) n[3];
+		}
+
+
+		void MergeValue(uint count, QuantilesData::Data& data, double value)
+		{
+			for (uint q = 0; q != (uint) nbQuantiles; ++q)
+				Insert(data.quantile[q], QuantilesData::Probabilities[q], count, value);
+		}
+
+
+		template<uint Size, class A, class U>
+		void MergeArray(uint count, A& results, const U& values)
+		{
+			for (uint i = 0; i != Size; ++i)
+				MergeValue(count, results[i], values[i]);
+		}
+
+
+	} // anonymous namespace
+
+
+
+	const double QuantilesData::Probabilities[QuantilesData::nbQuantiles] = {0.1, 0.5, 0.9};
+
+	const char* const QuantilesData::Captions[QuantilesData::nbQuantiles] = {"P10", "P50", "P90"};
+
+
+
+	QuantilesData::QuantilesData()
+		:count(0),
+		annual(nullptr),
+		monthly(nullptr),
+		weekly(nullptr),
+		daily(nullptr),
+		hourly(nullptr)
+	{
+	}
+
+
+	QuantilesData::~QuantilesData()
+	{
+		delete[] annual;
+		Antares::Memory::Release(hourly);
+	}
+
+
+	void QuantilesData::initialize()
+	{
+		if (not annual)
+		{
+			annual  = new Data[nbPeriodValues];
+			monthly = annual  + 1;
+			weekly  = monthly + maxMonths;
+			daily   = weekly  + maxWeeksInAYear;
+		}
+		Antares::Memory::Allocate(hourly, maxHoursInAYear);
+	}
+
+
+	void QuantilesData::releaseHourlyValues()
+	{
+		Antares::Memory::Release(hourly);
+	}
+
+
+	void QuantilesData::reset()
+	{
+		// The markers will be overwritten by the first years
+		count = 0;
+	}
+
+
+	void QuantilesData::merge(uint, const IntermediateValues& rhs)
+	{
+		assert(annual && "the quantiles have not been initialized");
+		MergeArray<maxMonths       >(count, monthly, rhs.month);
+		MergeArray<maxWeeksInAYear >(count, weekly,  rhs.week);
+		MergeArray<maxDaysInAYear  >(count, daily,   rhs.day);
+		if (hourly)
+			MergeArray<maxHoursInAYear >(count, hourly,  rhs.hour);
+		MergeValue(count, *annual, rhs.year);
+		++count;
+	}
+
+
+	double QuantilesData::value(const Data& data, uint q) const
+	{
+		const Estimator& e = data.quantile[q];
+		if (count >= (uint) nbMarkers)
+			return e.height[2];
+		if (!count)
+			return 0.;
+
+		// Exact quantile, with a linear interpolation between the closest ranks
+		double sorted[nbMarkers];
+		std::copy(e.height, e.height + count, sorted);
+		std::sort(sorted, sorted + count);
+		const double rank = Probabilities[q] * (double) (count - 1);
+		const uint lower = (uint) rank;
+		const uint upper = (lower + 1 < count) ? lower + 1 : lower;
+		return sorted[lower] + (rank - (double) lower) * (sorted[upper] - sorted[lower]);
+	}
+
+
+
+
+
+} // namespace AllYears
+} // namespace R
+} // namespace Variable
+} // namespace Solver
+} // namespace Antares
+
@@ -0,0 +1,139 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#ifndef __SOLVER_VARIABLE_STORAGE_QUANTILES_DATA_H__
+# define __SOLVER_VARIABLE_STORAGE_QUANTILES_DATA_H__
+
+# include <antares/study.h>
+# include <antares/memory/memory.h>
+
+
+namespace Antares
+{
+namespace Solver
+{
+namespace Variable
+{
+namespace R
+{
+namespace AllYears
+{
+
+
+	/*!
+	** \brief Estimation of some quantiles throughout all years, without keeping the values of each year
+	**
+	** Each quantile of each time step is estimated by the P-square algorithm
+	** (Jain & Chlamtac, 1985) : only 5 markers are kept whatever the number of
+	** years. The estimation is exact up to 5 years.
+	*/
+	class QuantilesData
+	{
+	public:
+		enum
+		{
+			//! The number of quantiles to estimate
+			nbQuantiles = 3,
+			//! The number of markers of the P-square algorithm
+			nbMarkers = 5,
+			//! The number of annual, monthly, weekly and daily time steps
+			nbPeriodValues = 1 + maxMonths + maxWeeksInAYear + maxDaysInAYear,
+		};
+
+		//! The probabilities of the quantiles (0.1, 0.5, 0.9)
+		static const double Probabilities[nbQuantiles];
+		//! The captions of the quantiles, as they appear in the outputs
+		static const char* const Captions[nbQuantiles];
+
+		//! Markers for a single quantile
+		struct Estimator
+		{
+			//! Heights of the markers (or the first values when less than 5 years)
+			double height[nbMarkers];
+			//! Positions (1-based) of the inner markers (the first and last ones are at 1 and n)
+			Yuni::uint32 position[nbMarkers - 2];
+		};
+
+		//! All the quantiles of a single time step
+		struct Data
+		{
+			Estimator quantile[nbQuantiles];
+		};
+
+	public:
+		//! \name Constructor & Destructor
+		//@{
+		/*!
+		** \brief Default constructor
+		*/
+		QuantilesData();
+		//! Destructor
+		~QuantilesData();
+		//@}
+
+		//! Allocate the markers (only when the quantiles are enabled)
+		void initialize();
+		//! Release the hourly values (hourly results not printed)
+		void releaseHourlyValues();
+
+		void reset();
+
+		/*!
+		** \brief Merge the values of a single year
+		**
+		** The years are merged one after the other (see computeSummary())
+		*/
+		void merge(uint year, const IntermediateValues& rhs);
+
+		/*!
+		** \brief Get the estimation of a quantile from its markers
+		*/
+		double value(const Data& data, uint q) const;
+
+	public:
+		//! The number of years merged so far
+		uint count;
+
+		//! The markers of all the periods (a single block, see initialize())
+		Data* annual;
+		Data* monthly;
+		Data* weekly;
+		Data* daily;
+		Antares::Memory::Stored<Data>::Type  hourly;
+
+	}; // class QuantilesData
+
+
+
+
+
+} // namespace AllYears
+} // namespace R
+} // namespace Variable
+} // namespace Solver
+} // namespace Antares
+
+#endif // __SOLVER_VARIABLE_STORAGE_QUANTILES_DATA_H__
@@ -0,0 +1,223 @@
+/*
+** Copyright 2007-2018 RTE
+** Authors: Antares_Simulator Team
+**
+** This file is part of Antares_Simulator.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** There are special exceptions to the terms and conditions of the
+** license as they are applied to this software. View the full text of
+** the exceptions in file COPYING.txt in the directory of this software
+** distribution
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with Antares_Simulator. If not, see <http://www.gnu.org/licenses/>.
+**
+** SPDX-License-Identifier: licenceRef-GPL3_WITH_RTE-Exceptions
+*/
+#ifndef __SOLVER_VARIABLE_STORAGE_QUANTILES_H__
+# define __SOLVER_VARIABLE_STORAGE_QUANTILES_H__
+
+# include "quantiles-data.h"
+
+
+namespace Antares
+{
+namespace Solver
+{
+namespace Variable
+{
+namespace R
+{
+namespace AllYears
+{
+
+
+	/*!
+	** \brief Quantiles (P10, P50, P90) throughout all years
+	**
+	** The quantiles are estimated year after year (see QuantilesData), thus
+	** the values of each year are not required.
+	** They are only computed and written when the option `mc-quantiles` of
+	** the study is enabled, so the outputs keep their format by default.
+	*/
+	template<class NextT = Empty, int FileFilter = Variable::Category::allFile>
+	struct Quantiles : public NextT
+	{
+	public:
+		//! Type of the net item in the list
+		typedef NextT NextType;
+
+		enum
+		{
+			//! The count if item in the list
+			count = QuantilesData::nbQuantiles + NextT::count,
+
+			categoryFile = NextT::categoryFile | Variable::Category::allFile,
+		};
+
+		//! Name of the filter
+		static const char* Name() {return "quantiles";}
+
+	public:
+		Quantiles() :
+			enabled(false)
+		{}
+
+	protected:
+		void initializeFromStudy(Antares::Data::Study& study)
+		{
+			enabled = study.parameters.mcQuantiles;
+			if (enabled)
+				quantiles.initialize();
+			// Next
+			NextType::initializeFromStudy(study);
+		}
+
+		void reset()
+		{
+			// Reset
+			quantiles.reset();
+			// Next
+			NextType::reset();
+		}
+
+		void releaseHourlyValues()
+		{
+			quantiles.releaseHourlyValues();
+			// Next
+			NextType::releaseHourlyValues();
+		}
+
+		void merge(uint year, const IntermediateValues& rhs)
+		{
+			if (enabled)
+				quantiles.merge(year, rhs);
+			// Next
+			NextType::merge(year, rhs);
+		}
+
+		void mergeHourInYear(uint year, uint hour, const double value)
+		{
+			// Next
+			NextType::mergeHourInYear(year, hour, value);
+		}
+
+
+		template<class S, class VCardT>
+		void buildSurveyReport(SurveyResults& report, const S& results, int dataLevel, int fileLevel, int precision) const
+		{
+			if (enabled && !(fileLevel & Category::id) && !(fileLevel & Category::mc))
+			{
+				switch (precision)
+				{
+					case Category::hourly:
+						InternalExportValues<maxHoursInAYear, VCardT>(report, Memory::RawPointer(quantiles.hourly));
+						break;
+					case Category::daily:
+						InternalExportValues<maxDaysInAYear, VCardT>(report, quantiles.daily);
+						break;
+					case Category::weekly:
+						InternalExportValues<maxWeeksInAYear, VCardT>(report, quantiles.weekly);
+						break;
+					case Category::monthly:
+						InternalExportValues<maxMonths, VCardT>(report, quantiles.monthly);
+						break;
+					case Category::annual:
+						InternalExportValues<1, VCardT>(report, quantiles.annual);
+						break;
+				}
+			}
+			// Next
+			NextType::template buildSurveyReport<S,VCardT>(report, results, dataLevel, fileLevel, precision);
+		}
+
+
+		Yuni::uint64 memoryUsage() const
+		{
+			return
+				(enabled ? sizeof(QuantilesData::Data) * QuantilesData::nbPeriodValues : 0)
+			# ifndef ANTARES_SWAP_SUPPORT
+				+ (enabled ? sizeof(QuantilesData::Data) * maxHoursInAYear : 0)
+			# endif
+				+ NextType::memoryUsage();
+		}
+
+
+		static void EstimateMemoryUsage(Antares::Data::StudyMemoryUsage& u)
+		{
+			if (u.study.parameters.mcQuantiles)
+			{
+				u.requiredMemoryForOutput += sizeof(QuantilesData::Data) * QuantilesData::nbPeriodValues;
+				if (u.hourlySynthesis)
+					Antares::Memory::EstimateMemoryUsage(sizeof(QuantilesData::Data), maxHoursInAYear, u, false);
+				for (uint q = 0; q != (uint) QuantilesData::nbQuantiles; ++q)
+					u.takeIntoConsiderationANewTimeserieForDiskOutput();
+			}
+			NextType::EstimateMemoryUsage(u);
+		}
+
+
+		template<template<class,int> class DecoratorT>
+		Antares::Memory::Stored<double>::ConstReturnType hourlyValuesForSpatialAggregate() const
+		{
+			return NextType::template hourlyValuesForSpatialAggregate<DecoratorT>();
+		}
+
+	public:
+		QuantilesData quantiles;
+
+	private:
+		//! The quantiles are computed (option `mc-quantiles`)
+		bool enabled;
+
+	private:
+		template<uint Size, class VCardT>
+		void InternalExportValues(SurveyResults& report, const QuantilesData::Data* array) const
+		{
+			assert(array);
+
+			for (uint q = 0; q != (uint) QuantilesData::nbQuantiles; ++q)
+			{
+				assert(report.data.columnIndex < report.maxVariables && "Column index out of bounds");
+
+				// Caption
+				report.captions[0][report.data.columnIndex] = report.variableCaption;
+				report.captions[1][report.data.columnIndex] = VCardT::Unit();
+				report.captions[2][report.data.columnIndex] = QuantilesData::Captions[q];
+				// Precision
+				report.precision[report.data.columnIndex] = PrecisionToPrintfFormat<VCardT::decimal>::Value();
+
+				// Values
+				double* v = report.values[report.data.columnIndex];
+				for (uint i = 0; i != Size; ++i)
+					v[i] = quantiles.value(array[i], q);
+
+				// Next column index
+				++report.data.columnIndex;
+			}
+		}
+
+	}; // class Quantiles
+
+
+
+
+
+
+} // namespace AllYears
+} // namespace R
+} // namespace Variable
+} // namespace Solver
+} // namespace Antares
+
+#endif // __SOLVER_VARIABLE_STORAGE_QUANTILES_H__
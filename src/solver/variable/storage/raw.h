@@ -89,6 +89,13 @@ namespace AllYears
 			NextType::reset();
 		}
 
+		inline void releaseHourlyValues()
+		{
+			rawdata.releaseHourlyValues();
+			// Next
+			NextType::releaseHourlyValues();
+		}
+
 		inline void merge(uint year, const IntermediateValues& rhs)
 		{
 			rawdata.merge(year, rhs);
@@ -183,7 +190,8 @@ namespace AllYears
 		static void EstimateMemoryUsage(Antares::Data::StudyMemoryUsage& u)
 		{
 			u.requiredMemoryForOutput += sizeof(double) * u.years;
-			Antares::Memory::EstimateMemoryUsage(sizeof(double), maxHoursInAYear, u, false);
+			if (u.hourlySynthesis)
+				Antares::Memory::EstimateMemoryUsage(sizeof(double), maxHoursInAYear, u, false);
 			u.takeIntoConsiderationANewTimeserieForDiskOutput();
 			NextType::EstimateMemoryUsage(u);
 		}
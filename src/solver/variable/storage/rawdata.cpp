@@ -64,10 +64,17 @@ namespace AllYears
 	}
 
 
+	void RawData::releaseHourlyValues()
+	{
+		Antares::Memory::Release(hourly);
+	}
+
+
 	void RawData::reset()
 	{
 		// Reset
-		Antares::Memory::Zero(maxHoursInAYear, hourly);
+		if (hourly)
+			Antares::Memory::Zero(maxHoursInAYear, hourly);
 		(void)::memset(monthly, 0, sizeof(double) * maxMonths);
 		(void)::memset(weekly,  0, sizeof(double) * maxWeeksInAYear);
 		(void)::memset(daily,   0, sizeof(double) * maxDaysInAYear);
@@ -79,8 +86,11 @@ namespace AllYears
 	{
 		unsigned int i;
 		// StdDeviation value for each hour throughout all years
-		for (i = 0; i != maxHoursInAYear; ++i)
-			hourly[i] += rhs.hour[i];
+		if (hourly)
+		{
+			for (i = 0; i != maxHoursInAYear; ++i)
+				hourly[i] += rhs.hour[i];
+		}
 		// StdDeviation value for each day throughout all years
 		for (i = 0; i != maxDaysInAYear; ++i)
 			daily[i] += rhs.day[i];
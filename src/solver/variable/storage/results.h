@@ -83,6 +83,14 @@ namespace Variable
 		*/
 		void reset();
 
+		/*!
+		** \brief Release the hourly values throughout all years
+		**
+		** The hourly results are not printed (see the output filters of
+		** the area or the link) : neither allocated nor merged anymore.
+		*/
+		void releaseHourlyValues();
+
 		/*!
 		** \brief Merge the intermediate values
 		*/
@@ -132,6 +140,7 @@ namespace Variable
 # include "minmax.h"
 # include "average.h"
 # include "stdDeviation.h"
+# include "quantiles.h"
 # include "and.h"
 # include "or.h"
 
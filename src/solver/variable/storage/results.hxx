@@ -75,6 +75,14 @@ namespace Variable
 	}
 
 
+	template<class FirstDecoratorT, template<class,int> class DecoratorForSpatialAggregateT>
+	inline void
+	Results<FirstDecoratorT,DecoratorForSpatialAggregateT>::releaseHourlyValues()
+	{
+		DecoratorType::releaseHourlyValues();
+	}
+
+
 
 
 } // namespace Variable
@@ -104,18 +104,29 @@ namespace AllYears
 			(void)::memset(stdDeviationMonthly, 0, sizeof(double) * maxMonths);
 			(void)::memset(stdDeviationWeekly,  0, sizeof(double) * maxWeeksInAYear);
 			(void)::memset(stdDeviationDaily,   0, sizeof(double) * maxDaysInAYear);
-			Antares::Memory::Zero(maxHoursInAYear, stdDeviationHourly);
+			if (stdDeviationHourly)
+				Antares::Memory::Zero(maxHoursInAYear, stdDeviationHourly);
 			stdDeviationYear = 0.;
 			// Next
 			NextType::reset();
 		}
 
+		void releaseHourlyValues()
+		{
+			Antares::Memory::Release(stdDeviationHourly);
+			// Next
+			NextType::releaseHourlyValues();
+		}
+
 		void merge(unsigned int year, const IntermediateValues& rhs)
 		{
 			unsigned int i;
 			// StdDeviation value for each hour throughout all years
-			for (i = 0; i != maxHoursInAYear; ++i)
-				stdDeviationHourly[i] += rhs.hour[i] * rhs.hour[i] * pRatio;
+			if (stdDeviationHourly)
+			{
+				for (i = 0; i != maxHoursInAYear; ++i)
+					stdDeviationHourly[i] += rhs.hour[i] * rhs.hour[i] * pRatio;
+			}
 			// StdDeviation value for each day throughout all years
 			for (i = 0; i != maxDaysInAYear; ++i)
 				stdDeviationDaily[i] += rhs.day[i] * rhs.day[i] * pRatio;
@@ -198,7 +209,8 @@ namespace AllYears
 
 		static void EstimateMemoryUsage(Antares::Data::StudyMemoryUsage& u)
 		{
-			Memory::EstimateMemoryUsage(sizeof(double), maxHoursInAYear, u, false);
+			if (u.hourlySynthesis)
+				Memory::EstimateMemoryUsage(sizeof(double), maxHoursInAYear, u, false);
 			u.takeIntoConsiderationANewTimeserieForDiskOutput();
 			NextType::EstimateMemoryUsage(u);
 		}
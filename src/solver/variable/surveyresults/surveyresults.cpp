@@ -32,6 +32,9 @@
 #include <antares/logs.h>
 #include <yuni/io/file.h>
 #include <antares/io/file.h>
+#include <antares/double-to-string.h>
+#include <antares/io/binary-results.h>
+#include <vector>
 
 using namespace Yuni;
 using namespace Antares;
@@ -113,13 +116,7 @@ namespace Private
 						}
 						else
 						{
-							// The snprintf routine is required since we may not have the ending zero
-							// with the standard printf. The conversion may require a bigger buffer.
-							# ifdef YUNI_OS_MSVC
-							sizePrintf = ::sprintf_s(conversionBuffer + 1, sizeof(conversionBuffer)-2, "%.0f", v);
-							# else
-							sizePrintf = ::snprintf(conversionBuffer + 1, sizeof(conversionBuffer)-2, "%.0f", v);
-							# endif
+							sizePrintf = DoubleToFixedString(conversionBuffer + 1, sizeof(conversionBuffer)-2, v, 0);
 							if (sizePrintf >= 0)
 								pFileBuffer.append((const char*)conversionBuffer, 1 + sizePrintf);
 							else
@@ -419,9 +416,9 @@ namespace Variable
 	}
 
 
-	template<class StringT, class ConvertT, class PrecisionT>
+	template<class StringT, class ConvertT>
 	inline void
-	SurveyResults::AppendDoubleValue(uint& error, double v, StringT& buffer, ConvertT& conversionBuffer, const PrecisionT& precision)
+	SurveyResults::AppendDoubleValue(uint& error, double v, StringT& buffer, ConvertT& conversionBuffer, uint decimals)
 	{
 		if (not Math::Zero(v))
 		{
@@ -445,14 +442,8 @@ namespace Variable
 				}
 				else
 				{
-
-					# ifdef YUNI_OS_MSVC
-					int sizePrintf = ::sprintf_s(conversionBuffer + 1, sizeof(conversionBuffer) - 2,
-						precision.c_str(), v);
-					# else
-					int sizePrintf = ::snprintf(conversionBuffer + 1, sizeof(conversionBuffer) - 2,
-						precision.c_str(), v);
-					# endif
+					int sizePrintf = DoubleToFixedString(conversionBuffer + 1, sizeof(conversionBuffer) - 2,
+						v, decimals);
 
 					if (sizePrintf >= 0)
 					{
@@ -670,13 +661,8 @@ namespace Variable
 				}
 				else
 				{
-					// The snprintf routine is required since we may not have the ending zero
-					// with the standard printf. The conversion may require a bigger buffer.
-					# ifdef YUNI_OS_MSVC
-					sizePrintf = ::sprintf_s(conversionBuffer + 1, sizeof(conversionBuffer)-2, precision[i].c_str(), values[i][y]);
-					# else
-					sizePrintf = ::snprintf(conversionBuffer + 1, sizeof(conversionBuffer)-2, precision[i].c_str(), values[i][y]);
-					# endif
+					sizePrintf = DoubleToFixedString(conversionBuffer + 1, sizeof(conversionBuffer)-2, values[i][y],
+						PrintfFormatToPrecision(precision[i]));
 					if (sizePrintf >= 0)
 						data.fileBuffer.append((const char*)conversionBuffer, 1 + sizePrintf);
 					else
@@ -764,6 +750,11 @@ namespace Variable
 			assert(not precision[x].empty() && "invalid precision");
 		# endif
 
+		// Number of decimals for each column, instead of parsing the printf format for each cell
+		std::vector<uint> decimals(data.columnIndex);
+		for (uint x = 0; x != data.columnIndex; ++x)
+			decimals[x] = PrintfFormatToPrecision(precision[x]);
+
 		if (fileLevel & Category::mc)
 		{
 			// Each row
@@ -778,7 +769,7 @@ namespace Variable
 				// Each column
 				assert(data.columnIndex <= data.matrix.width);
 				for (uint x = 0; x != data.columnIndex; ++x)
-					AppendDoubleValue(error, data.matrix[x][y], data.fileBuffer, conversionBuffer, precision[x]);
+					AppendDoubleValue(error, data.matrix[x][y], data.fileBuffer, conversionBuffer, decimals[x]);
 
 				// End of line
 				data.fileBuffer += '\n';
@@ -797,7 +788,7 @@ namespace Variable
 				// Each column
 				assert(data.columnIndex <= maxVariables);
 				for (uint x = 0; x != data.columnIndex; ++x)
-					AppendDoubleValue(error, values[x][y], data.fileBuffer, conversionBuffer, precision[x]);
+					AppendDoubleValue(error, values[x][y], data.fileBuffer, conversionBuffer, decimals[x]);
 
 				// End of line
 				data.fileBuffer += '\n';
@@ -805,6 +796,45 @@ namespace Variable
 		}
 
 		IOFileSetContent(data.filename, data.fileBuffer);
+
+		if (data.study.parameters.binaryResults)
+			saveToBinaryFile(dataLevel, fileLevel, precisionLevel, heightBegin, heightEnd, decimals);
+	}
+
+
+	void SurveyResults::saveToBinaryFile(int dataLevel, int fileLevel, int precisionLevel,
+		uint heightBegin, uint heightEnd, const std::vector<uint>& decimals)
+	{
+		// The same filename, with the extension .bin instead of .txt
+		String filename;
+		filename << data.filename;
+		String::Size dot = filename.rfind('.');
+		if (dot < filename.size())
+			filename.resize(dot);
+		filename << ".bin";
+
+		// The text buffer is not needed anymore
+		BinaryResults::Writer writer(data.fileBuffer);
+
+		String name;
+		if (data.area)
+			name << data.area->name;
+		else
+			name << "system";
+		if (data.link)
+			name << " - " << data.link->with->name;
+
+		writer.begin(dataLevel, fileLevel, precisionLevel, heightBegin, heightEnd - heightBegin, name);
+
+		for (uint x = 0; x != data.columnIndex; ++x)
+		{
+			if (fileLevel & Category::mc)
+				writer.addColumn(captions[0][x], captions[1][x], captions[2][x], decimals[x], data.matrix[x]);
+			else
+				writer.addColumn(captions[0][x], captions[1][x], captions[2][x], decimals[x], values[x]);
+		}
+
+		IOFileSetContent(filename, data.fileBuffer);
 	}
 
 
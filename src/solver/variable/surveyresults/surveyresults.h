@@ -29,6 +29,7 @@
 
 # include <yuni/yuni.h>
 # include <yuni/core/string.h>
+# include <vector>
 # include "../constants.h"
 # include <antares/study.h>
 # include "../categories.h"
@@ -135,11 +136,17 @@ namespace Variable
 		*/
 		void exportGridInfosAreas(const Yuni::String& folder);
 
-		template<class StringT, class ConvertT, class PrecisionT>
-		void AppendDoubleValue(uint& error, const double v, StringT& buffer, ConvertT& conversionBuffer, const PrecisionT& precision);
+		template<class StringT, class ConvertT>
+		void AppendDoubleValue(uint& error, const double v, StringT& buffer, ConvertT& conversionBuffer, uint decimals);
 
 		void writeDateToFileDescriptor(uint row, int fileLevel, int precisionLevel);
 
+		/*!
+		** \brief Write the same results in the binary columnar format (see BinaryResults)
+		*/
+		void saveToBinaryFile(int dataLevel, int fileLevel, int precisionLevel,
+			uint heightBegin, uint heightEnd, const std::vector<uint>& decimals);
+
 	}; // class SurveyResults
 
 
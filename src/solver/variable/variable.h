@@ -78,6 +78,9 @@ namespace Variable
 		{
 			categoryDataLevel = VCardType::categoryDataLevel,
 			categoryFileLevel = VCardType::categoryFileLevel,
+			//! Keep the hourly results throughout all years, whatever the output filters
+			// (to override when those values are used by the solver itself)
+			hourlySynthesisRequired = 0,
 		};
 
 		template<int CDataLevel, int CFile>
@@ -156,6 +159,16 @@ namespace Variable
 		** \param cluster The thermal cluster
 		*/
 		void initializeFromThermalCluster(Data::Study* study, Data::Area* area, Data::ThermalCluster* cluster);
+
+		/*!
+		** \brief Apply the output filter of the area or the link to the results
+		**
+		** The hourly results throughout all years are released when they
+		** are not printed, and are not merged anymore at the end of each year.
+		**
+		** \param filter The filter of the synthesis (see Data::FilterFlag)
+		*/
+		void applySynthesisFilter(uint filter);
 		//@}
 
 
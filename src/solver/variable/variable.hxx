@@ -28,6 +28,7 @@
 # define __SOLVER_VARIABLE_VARIABLE_HXX__
 
 # include <yuni/core/static/types.h>
+# include <antares/study/filter.h>
 
 
 
@@ -45,8 +46,12 @@ namespace Variable
 		if ((int)VCardT::columnCount != (int) Category::dynamicColumns)
 		{
 			// Results
+			const bool hourlySynthesis = u.hourlySynthesis;
+			if (ChildT::hourlySynthesisRequired)
+				u.hourlySynthesis = true;
 			for (uint i = 0; i != VCardT::columnCount; ++i)
 				ResultsType::EstimateMemoryUsage(u);
+			u.hourlySynthesis = hourlySynthesis;
 
 			// Intermediate values
 			if (VCardT::hasIntermediateValues)
@@ -124,6 +129,17 @@ namespace Variable
 	}
 
 
+	template<class ChildT, class NextT, class VCardT>
+	inline void
+	IVariable<ChildT,NextT,VCardT>::applySynthesisFilter(uint filter)
+	{
+		if (not ChildT::hourlySynthesisRequired && not (filter & Data::filterHourly))
+			VariableAccessorType::ReleaseHourlyValues(pResults);
+		// Next
+		NextType::applySynthesisFilter(filter);
+	}
+
+
 	template<class ChildT, class NextT, class VCardT>
 	inline void
 	IVariable<ChildT,NextT,VCardT>::simulationBegin()
@@ -38,6 +38,10 @@
 #include "../../ui/common/winmain.hxx"
 #include <antares/version.h>
 #include <antares/locale.h>
+#include <yuni/core/system/cpu.h>
+#include <yuni/job/job.h>
+#include <yuni/job/queue/service.h>
+#include <yuni/job/queue/q-event.h>
 #ifdef YUNI_OS_WINDOWS
 # include <process.h>
 #endif
@@ -66,6 +70,69 @@ namespace // anonymous
 	};
 
 
+	/*!
+	** \brief Run the solver on a single study
+	**
+	** Several jobs may be run simultaneously (see the option --jobs), each of
+	** them waiting for its own solver process.
+	*/
+	class StudyRunJob final : public Job::IJob
+	{
+	public:
+		StudyRunJob(const String& studypath, const String& cmd, uint index, uint count) :
+			studypath(studypath),
+			cmd(cmd),
+			index(index),
+			count(count)
+		{}
+		virtual ~StudyRunJob() {}
+
+	public:
+		//! The study folder
+		const String studypath;
+		//! The command line to execute
+		const String cmd;
+		//! Index of the study (1-based, for the logs only)
+		const uint index;
+		//! The total number of studies
+		const uint count;
+
+	protected:
+		virtual void onExecute() override
+		{
+			logs.info();
+			logs.checkpoint() << "Running simulation: `" << studypath << "` ("
+				<< index << '/' << count << ')';
+			logs.info() << "Executing " << cmd;
+
+			// Execute the command
+			if (-1 == system(cmd.c_str()))
+			{
+				# ifdef YUNI_OS_WINDOWS
+				switch (errno)
+				{
+					case E2BIG:
+						logs.error() << "Argument list (which is system dependent) is too big";
+						break;
+					case ENOENT:
+						logs.error() << "Command interpreter cannot be found";
+						break;
+					case ENOEXEC:
+						logs.error() << "Command-interpreter file has invalid format and is not executable";
+						break;
+					case ENOMEM:
+						logs.error() << "Not enough memory is available to execute command";
+						break;
+				}
+				# endif
+			}
+			else
+				logs.info() << "Finished: `" << studypath << "` (" << index << '/' << count << ')';
+		}
+
+	}; // class StudyRunJob
+
+
 } // anonymous namespace
 
 
@@ -98,6 +165,8 @@ int main(int argc, char* argv[])
 	Nullable<uint> optYears;
 	Nullable<String> optSolver;
 	Nullable<String> optName;
+	uint optJobs = 1;
+	uint optCores = 0;
 
 	// Command Line options
 	{
@@ -129,6 +198,12 @@ int main(int argc, char* argv[])
 		options.addParagraph("\nExtras");
 		options.add(optSolver, ' ', "solver", "Specify the antares-solver location");
 		options.addFlag(optSwap, 's', "swap", "Swap mode");
+
+		options.addParagraph("\nScheduling");
+		options.add(optJobs, 'j', "jobs", "Number of studies simulated simultaneously (default: 1)");
+		options.add(optCores, ' ', "cores",
+			"Number of cores shared by the simulations run simultaneously (default: all)."
+			" Each solver is given the same share with --force-parallel");
 		options.remainingArguments(optInput);
 		// Version
 		options.addParagraph("\nMisc.");
@@ -154,6 +229,11 @@ int main(int argc, char* argv[])
 			logs.error() << "contradictory options: --economy and --adequacy";
 			return EXIT_FAILURE;
 		}
+		if (0 == optJobs)
+		{
+			logs.error() << "invalid number of jobs";
+			return EXIT_FAILURE;
+		}
 	}
 
 
@@ -214,17 +294,29 @@ int main(int argc, char* argv[])
 		String dirname;
 		IO::ExtractFilePath(dirname, solver);
 
+		// Splitting the cores between the simulations run simultaneously
+		uint nbJobs = Math::Min<uint>(optJobs, (uint)finder.list.size());
+		uint coresPerStudy = 0; // 0: let the solver use the settings of the study
+		if (nbJobs > 1 or optCores != 0)
+		{
+			uint nbCores = (optCores != 0) ? optCores : System::CPU::Count();
+			coresPerStudy = Math::Max<uint>(1, nbCores / nbJobs);
+			logs.info() << "  " << nbJobs << " simulation(s) at a time, "
+				<< coresPerStudy << " core(s) for each of them";
+		}
+
+		// Changing the current working directory (common to all solvers)
+		IO::Directory::Current::Set(dirname);
+
+		Job::QueueService queueservice;
+		queueservice.maximumThreadCount(nbJobs);
+
 		String cmd;
 
 		uint studyIndx = 0;
 		foreach (auto& studypath, finder.list)
 		{
 			++studyIndx;
-			logs.info();
-			logs.info();
-			logs.checkpoint() << "Running simulation: `" << studypath << "` ("
-				<< studyIndx << '/' << (uint)finder.list.size() << ')';
-			logs.debug();
 
 			cmd.clear();
 			if (not System::windows)
@@ -250,36 +342,18 @@ int main(int argc, char* argv[])
 				cmd << " --no-ts-import";
 			if (optIgnoreAllConstraints)
 				cmd << " --no-constraints";
+			if (coresPerStudy != 0)
+				cmd << " --force-parallel=" << coresPerStudy;
 			cmd << " \"" << studypath << "\"";
 
-			// Changing the current working directory
-			IO::Directory::Current::Set(dirname);
-			// Executing the converter
-			logs.info() << "Executing " << cmd;
-
-			// Execute the command
-			if (-1 == system(cmd.c_str()))
-			{
-				# ifdef YUNI_OS_WINDOWS
-				switch (errno)
-				{
-					case E2BIG:
-						logs.error() << "Argument list (which is system dependent) is too big";
-						break;
-					case ENOENT:
-						logs.error() << "Command interpreter cannot be found";
-						break;
-					case ENOEXEC:
-						logs.error() << "Command-interpreter file has invalid format and is not executable";
-						break;
-					case ENOMEM:
-						logs.error() << "Not enough memory is available to execute command";
-						break;
-				}
-				# endif
-			}
+			queueservice += new StudyRunJob(studypath, cmd, studyIndx, (uint)finder.list.size());
 		}
 
+		queueservice.start();
+		queueservice.wait(Yuni::qseIdle);
+		queueservice.stop();
+
+		logs.info();
 		logs.info() << "Done.";
 
 
@@ -27,6 +27,10 @@
 
 #include "job.h"
 #include <antares/logs.h>
+#include <antares/io/binary-results.h>
+#include <antares/double-to-string.h>
+#include <yuni/core/math.h>
+#include <vector>
 #include "progress.h"
 
 using namespace Yuni;
@@ -80,6 +84,15 @@ void JobFileReader::onExecute()
 {
 	if (!datafile || !output || !path || !output->canContinue())
 		return;
+
+	// The binary results, when available, do not require any parsing
+	if (binaryFileExists())
+	{
+		if (readBinaryFile())
+			storeResults();
+		return;
+	}
+
 	if (!openCSVFile())
 		return;
 	if (!prepareJumpTable())
@@ -120,6 +133,92 @@ bool JobFileReader::openCSVFile()
 
 
 
+bool JobFileReader::binaryFileExists()
+{
+	pFilename.clear();
+	pFilename << path << SEP;
+	studydata->append(pFilename);
+	pFilename << SEP << datafile->dataLevel << '-' << datafile->timeLevel << ".bin";
+	return IO::File::Exists(pFilename);
+}
+
+
+bool JobFileReader::readBinaryFile()
+{
+	Antares::BinaryResults::Reader reader;
+	if (!reader.loadFromFile(pFilename))
+	{
+		output->incrementError();
+		return false;
+	}
+	if (reader.rowCount > maxRows)
+	{
+		logs.error() << "Too many rows have been found (more than " << (uint)maxRows << "): " << pFilename;
+		output->incrementError();
+		return false;
+	}
+
+	const uint nbVars = (uint) output->columns.size();
+	assert(!pTmpResults);
+	assert(!pVariablesOn);
+	pVariablesOn = new bool[nbVars];
+	for (uint i = 0; i != nbVars; ++i)
+		pVariablesOn[i] = false;
+	pTmpResults = new TemporaryColumnData[nbVars];
+	for (uint i = 0; i != nbVars; ++i)
+		pTmpResults[i] = new CellData[maxRows];
+
+	uint jumpFound = 0;
+	String caption;
+	for (uint x = 0; x != (uint) reader.columns.size(); ++x)
+	{
+		auto& column = reader.columns[x];
+		caption = column.captions[0];
+		caption.trim(" \r");
+		caption.toLower();
+
+		for (uint j = 0; j != nbVars; ++j)
+		{
+			if (output->columns[j] == caption)
+			{
+				pVariablesOn[j] = true;
+				++jumpFound;
+				for (uint y = 0; y != reader.rowCount; ++y)
+					formatCell(pTmpResults[j][y], column.values[y], column.decimals);
+				break;
+			}
+		}
+	}
+
+	pLineCount = reader.rowCount;
+	return (0 != jumpFound);
+}
+
+
+void JobFileReader::formatCell(CellData& cell, double v, uint decimals)
+{
+	// Same as the text outputs of the solver
+	if (Math::Zero(v))
+	{
+		cell[0] = '0';
+		cell[1] = '\0';
+	}
+	else if (Math::NaN(v))
+		memcpy(cell, "NaN", 4);
+	else if (Math::Infinite(v))
+		memcpy(cell, (v > 0) ? "+inf" : "-inf", 5);
+	else
+	{
+		int size = Antares::DoubleToFixedString(cell, maxSizePerCell, v, decimals);
+		if (size < 0 || size >= (int) maxSizePerCell)
+		{
+			logs.warning() << "Content too long (" << v << "): " << pFilename;
+			cell[0] = '\0';
+		}
+	}
+}
+
+
 bool JobFileReader::readRawData()
 {
 	// The number of variables to fetch
@@ -301,6 +400,9 @@ bool JobFileReader::storeResults()
 	if (!pLineCount)
 		return false;
 
+	if (output->statistics)
+		return storeStatistics();
+
 	Yuni::MutexLocker locker(gResultsMutex);
 
 	// The total number of variables
@@ -358,6 +460,53 @@ bool JobFileReader::storeResults()
 
 
 
+bool JobFileReader::storeStatistics()
+{
+	if (!datafile)
+	{
+		logs.error() << "invalid data";
+		output->incrementError();
+		return false;
+	}
+
+	ResultsAllVars* allvars;
+	{
+		// Only the lookup requires the lock, the statistics have their own mutex
+		Yuni::MutexLocker locker(gResultsMutex);
+		allvars = &(output->results[studydata->name][datafile->dataLevel][datafile->timeLevel]);
+	}
+
+	// The total number of variables
+	const uint nbVars = Math::Min((uint) output->columns.size(), (uint) allvars->size());
+
+	std::vector<double> yearValues(pLineCount);
+
+	for (uint v = 0; v != nbVars; ++v)
+	{
+		// This variable may not have been found in the CSV file
+		if (!pVariablesOn[v])
+			continue;
+
+		const TemporaryColumnData& ref = pTmpResults[v];
+		for (uint y = 0; y != pLineCount; ++y)
+		{
+			AnyString cell(ref[y]);
+			if (!cell.to(yearValues[y]))
+				yearValues[y] = 0.;
+		}
+
+		if (!(*allvars)[v].statistics.merge(year, yearValues.data(), pLineCount))
+		{
+			logs.error() << "invalid number of rows for the year " << (year + 1) << ": " << pFilename;
+			output->incrementError();
+			return false;
+		}
+	}
+	return true;
+}
+
+
+
 bool JobFileReader::prepareJumpTable()
 {
 	// Looking for the 5th line
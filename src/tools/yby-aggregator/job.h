@@ -86,6 +86,17 @@ protected:
 	virtual void onExecute() override;
 
 private:
+	/*!
+	** \brief Get if the results are available in the binary format (see BinaryResults)
+	*/
+	bool binaryFileExists();
+	/*!
+	** \brief Read all values from the binary file
+	*/
+	bool readBinaryFile();
+	//! Convert a value into a cell, with the given number of decimals
+	void formatCell(CellData& cell, double v, uint decimals);
+
 	/*!
 	** \brief Try to open the CSV file
 	*/
@@ -103,6 +114,10 @@ private:
 	void readLine(const AnyString& line, uint y);
 
 	bool storeResults();
+	/*!
+	** \brief Merge the values of the year into the statistics (see Output::statistics)
+	*/
+	bool storeStatistics();
 
 	//! Reset the jump table
 	void resizeJumpTable(uint newsize);
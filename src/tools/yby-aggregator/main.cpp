@@ -70,8 +70,7 @@ static inline uint FindNbProcessors()
 	// The value will be based on the number of virtual CPUs
 	uint n = System::CPU::Count();
 	// But we sould keep an idle cpu to avoid overload
-	n = (n > 3) ? n - 1 : n;
-	return (n > 4) ? 4 : n;
+	return (n > 3) ? n - 1 : n;
 }
 
 
@@ -135,8 +134,29 @@ static void ConvertVarNameToID(String& id, const String& name)
 }
 
 
+static bool PrepareVariablePath(String& path, const String& mcvarfolder,
+	const AnyString& studyItemName, const AnyString& dataLevelName, const AnyString& timeLevelName,
+	const String& column)
+{
+	path.clear() << mcvarfolder << SEP << studyItemName;
+
+	if (!IO::Directory::Create(path))
+	{
+		logs.error() << "impossible to create the directory " << path;
+		return false;
+	}
+	path << SEP;
+	path << dataLevelName << '-' << timeLevelName << '-';
+	String varNameID;
+	ConvertVarNameToID(varNameID, column);
+	path << varNameID << ".txt";
+	return true;
+}
+
+
 static void PrepareTheWork(const String::Vector& outputs, const DataFile::Vector& dataFiles,
-	const StudyData::Vector& studydata, const String::Vector& columns)
+	const StudyData::Vector& studydata, const String::Vector& columns,
+	const std::vector<double>& quantiles, bool statistics)
 {
 	logs.checkpoint() << "Preparing the aggregation";
 	progressBar.interval(1500 /*ms*/);
@@ -178,6 +198,8 @@ static void PrepareTheWork(const String::Vector& outputs, const DataFile::Vector
 		Output::Ptr output = new Output(info.directory(), columns);
 		if (!output)
 			continue;
+		output->statistics = statistics;
+		output->quantiles  = quantiles;
 
 		if (not FindOutputFolder(info))
 			continue;
@@ -264,7 +286,12 @@ static void PrepareTheWork(const String::Vector& outputs, const DataFile::Vector
 				for (uint v = 0; v != allvars.size(); ++v)
 				{
 					ResultMatrix& mtrx = allvars[v];
-					mtrx.resize(maxYear);
+					// The values of each year are not kept with the statistics
+					// (except as float, for the quantiles)
+					if (statistics)
+						mtrx.statistics.resize(maxYear, not quantiles.empty());
+					else
+						mtrx.resize(maxYear);
 				}
 			}
 		}
@@ -286,6 +313,8 @@ static void ReadCommandLineOptions(int argc, char** argv)
 	String::Vector optDatum;
 	String::Vector optAreas;
 	String::Vector optLinks;
+	String::Vector optQuantiles;
+	bool optStatistics = false;
 	bool optForce = false;
 
 	// Command Line options
@@ -306,10 +335,16 @@ static void ReadCommandLineOptions(int argc, char** argv)
 		options.add(optColumns, 'c', "column", "add a column to consider during the aggregation");
 		options.addFlag(optForce, ' ', "force",  "ignore warnings");
 
+		options.addParagraph("\nStatistics");
+		options.addFlag(optStatistics, 's', "statistics",
+			"compute the average, std deviation, min and max over all years instead of"
+			" writing the values of each year (low memory usage)");
+		options.add(optQuantiles, 'q', "quantile", "add a quantile to compute, in [0, 1] (implies --statistics)");
+
 		options.addParagraph("\nResources");
 
 		options.add(optJobs, 'j', "jobs",
-					String() << "The number of jobs to run simultaneously (default: " << optJobs << ", 4 should be a maxmimum due to i/o performance considerations)");
+					String() << "The number of jobs to run simultaneously (default: " << optJobs << ")");
 		// --swap
 		options.add(optSwap, ' ', "swap-folder",
 			# ifdef ANTARES_SWAP_SUPPORT
@@ -371,6 +406,8 @@ static void ReadCommandLineOptions(int argc, char** argv)
 
 		if (optJobs < 1)
 			optJobs = 1;
+		if (optJobs > 512)
+			optJobs = 512;
 		queueService.maximumThreadCount(optJobs);
 	}
 
@@ -451,7 +488,23 @@ static void ReadCommandLineOptions(int argc, char** argv)
 	for (uint i = 0; i != optColumns.size(); ++i)
 		optColumns[i].toLower();
 
-	PrepareTheWork(optOutputs, dataFiles, studydata, optColumns);
+	// Quantiles
+	std::vector<double> quantiles;
+	for (uint i = 0; i != optQuantiles.size(); ++i)
+	{
+		double q;
+		optQuantiles[i].trim();
+		if (!optQuantiles[i].to(q) || q < 0. || q > 1.)
+		{
+			logs.error() << "invalid quantile: " << optQuantiles[i] << " (expected a value in [0, 1])";
+			continue;
+		}
+		quantiles.push_back(q);
+	}
+	if (not quantiles.empty())
+		optStatistics = true;
+
+	PrepareTheWork(optOutputs, dataFiles, studydata, optColumns, quantiles, optStatistics);
 }
 
 
@@ -529,6 +582,32 @@ static bool WriteAggregates()
 						Progress::Current = 0;
 
 						ResultMatrix& matrix = allvars[v];
+
+						if (output->statistics)
+						{
+							String path;
+							if (!PrepareVariablePath(path, mcvarfolder, studyItemName, dataLevelName,
+								timeLevelName, output->columns[v]))
+								continue;
+
+							const ResultStatistics& stats = matrix.statistics;
+							if (!stats.count)
+							{
+								logs.info() << " No data for the variable " << studyItemName << '/'
+									<< dataLevelName << '/' << timeLevelName << '/' << output->columns[v];
+								path << ".nodata";
+								if (!IO::File::CreateEmptyFile(path))
+									logs.error() << "I/O error: impossible to write " << path;
+							}
+							else
+							{
+								logs.info() << "    writing " << path << "  (" << stats.count << " years)";
+								if (!stats.saveToCSVFile(path, output->quantiles))
+									logs.error() << "impossible to write " << path;
+							}
+							continue;
+						}
+
 						if (!matrix.width)
 							continue;
 
@@ -558,18 +637,9 @@ static bool WriteAggregates()
 
 						// DATA filename
 						String path;
-						path << mcvarfolder << SEP << studyItemName;
-
-						if (!IO::Directory::Create(path))
-						{
-							logs.error() << "impossible to create the directory " << path;
+						if (!PrepareVariablePath(path, mcvarfolder, studyItemName, dataLevelName,
+							timeLevelName, output->columns[v]))
 							continue;
-						}
-						path << SEP;
-						path << dataLevelName << '-' << timeLevelName << '-';
-						String varNameID;
-						ConvertVarNameToID(varNameID, output->columns[v]);
-						path << varNameID << ".txt";
 
 						// Writing DATA
 						if (!requiredHeight)
@@ -30,6 +30,7 @@
 # include <yuni/yuni.h>
 # include <yuni/core/string.h>
 # include <set>
+# include <vector>
 # include "result.h"
 
 
@@ -48,7 +49,8 @@ public:
 public:
 	Output(const YString& target, const YString::Vector& cols) :
 		path(target),
-		columns(cols)
+		columns(cols),
+		statistics(false)
 	{
 	}
 
@@ -74,6 +76,10 @@ public:
 	const Yuni::String::Vector columns;
 	//! The number of errors
 	Yuni::Atomic::Int<>  errors;
+	//! True to compute the statistics over all years instead of keeping each year
+	bool statistics;
+	//! Quantiles to compute (in [0, 1], only with the statistics)
+	std::vector<double> quantiles;
 
 	//! Results
 	ResultsForAllStudyItems  results;
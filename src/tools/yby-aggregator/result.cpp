@@ -27,6 +27,11 @@
 
 #include "result.h"
 #include <antares/memory/memory.h>
+#include <antares/double-to-string.h>
+#include <yuni/core/math.h>
+#include <algorithm>
+#include <limits>
+#include <cmath>
 #include "progress.h"
 
 
@@ -48,6 +53,29 @@ namespace // anonymous
 	}
 
 
+	template<class StringT>
+	void AppendValueToBuffer(StringT& out, double v)
+	{
+		enum
+		{
+			//! The number of decimals for the statistics
+			decimals = 3,
+		};
+
+		if (Math::NaN(v))
+			out << "NaN";
+		else if (Math::Infinite(v))
+			out << ((v > 0) ? "+inf" : "-inf");
+		else
+		{
+			char cell[maxSizePerCell];
+			int size = Antares::DoubleToFixedString(cell, maxSizePerCell, v, decimals);
+			if (size > 0 && size < (int) maxSizePerCell)
+				out.append(cell, (uint) size);
+		}
+	}
+
+
 } // anonymous namespace
 
 
@@ -95,6 +123,206 @@ void ResultMatrix::resize(uint i)
 }
 
 
+ResultStatistics::ResultStatistics() :
+	count(0),
+	height(0),
+	nbYears(0),
+	average(nullptr),
+	sumOfSquares(nullptr),
+	minimum(nullptr),
+	maximum(nullptr),
+	values(nullptr),
+	pKeepValues(false)
+{}
+
+
+ResultStatistics::~ResultStatistics()
+{
+	release();
+}
+
+
+void ResultStatistics::release()
+{
+	delete[] average;
+	delete[] sumOfSquares;
+	delete[] minimum;
+	delete[] maximum;
+	delete[] values;
+	average = nullptr;
+	sumOfSquares = nullptr;
+	minimum = nullptr;
+	maximum = nullptr;
+	values = nullptr;
+}
+
+
+void ResultStatistics::resize(uint years, bool keepValues)
+{
+	release();
+	count = 0;
+	height = 0;
+	nbYears = years;
+	pKeepValues = keepValues;
+}
+
+
+void ResultStatistics::allocate(uint h)
+{
+	height = h;
+	average = new double[h];
+	sumOfSquares = new double[h];
+	minimum = new double[h];
+	maximum = new double[h];
+	for (uint y = 0; y != h; ++y)
+	{
+		average[y] = 0.;
+		sumOfSquares[y] = 0.;
+		minimum[y] = +std::numeric_limits<double>::infinity();
+		maximum[y] = -std::numeric_limits<double>::infinity();
+	}
+
+	if (pKeepValues)
+	{
+		// The missing years will be ignored by the quantiles
+		const size_t size = (size_t) nbYears * h;
+		values = new float[size];
+		for (size_t i = 0; i != size; ++i)
+			values[i] = std::numeric_limits<float>::quiet_NaN();
+	}
+}
+
+
+bool ResultStatistics::merge(uint year, const double* yearValues, uint h)
+{
+	if (!h || year >= nbYears)
+		return false;
+
+	MutexLocker locker(pMutex);
+
+	if (!height)
+		allocate(h);
+	else
+	{
+		if (h != height)
+			return false;
+	}
+
+	++count;
+	const double n = (double) count;
+	for (uint y = 0; y != h; ++y)
+	{
+		const double v = yearValues[y];
+		const double delta = v - average[y];
+		average[y] += delta / n;
+		sumOfSquares[y] += delta * (v - average[y]);
+		if (v < minimum[y])
+			minimum[y] = v;
+		if (v > maximum[y])
+			maximum[y] = v;
+	}
+
+	if (values)
+	{
+		float* column = values + (size_t) year * height;
+		for (uint y = 0; y != h; ++y)
+			column[y] = (float) yearValues[y];
+	}
+	return true;
+}
+
+
+bool ResultStatistics::saveToCSVFile(const String& filename, const std::vector<double>& quantiles) const
+{
+	IO::File::Stream file;
+	if (!file.openRW(filename))
+		return false;
+
+	const uint nbQuantiles = (values) ? (uint) quantiles.size() : 0u;
+
+	Progress::Total = height;
+	String buffer;
+	buffer.reserve(4 * 1024 * 1024);
+
+	// Writing pseudo header like any other CSV in antares
+	{
+		buffer
+			<< "mc-var\taggregate\n"
+			<< "\t\tBEGIN\tEND\n"
+			<< "\t\t1\t" << height << '\n';
+		buffer << '\n';
+		buffer << "\t\tEXP\tstd\tmin\tmax";
+		for (uint q = 0; q != nbQuantiles; ++q)
+			buffer << "\tQ" << (quantiles[q] * 100.);
+		buffer << '\n';
+
+		buffer << "\t\t" << count << '\t' << count << '\t' << count << '\t' << count;
+		for (uint q = 0; q != nbQuantiles; ++q)
+			buffer << '\t' << count;
+		buffer << '\n';
+
+		buffer << "\t\t\t\t\t";
+		for (uint q = 0; q != nbQuantiles; ++q)
+			buffer << '\t';
+		buffer << '\n';
+	}
+
+	// Temporary values of all years for a single row, for the quantiles
+	std::vector<float> sorted;
+	if (nbQuantiles)
+		sorted.reserve(nbYears);
+
+	for (uint y = 0; y != height; ++y)
+	{
+		buffer << '\t' << (1 + y) << '\t';
+		AppendValueToBuffer(buffer, average[y]);
+		buffer << '\t';
+		AppendValueToBuffer(buffer, std::sqrt(sumOfSquares[y] / (double) count));
+		buffer << '\t';
+		AppendValueToBuffer(buffer, minimum[y]);
+		buffer << '\t';
+		AppendValueToBuffer(buffer, maximum[y]);
+
+		if (nbQuantiles)
+		{
+			sorted.clear();
+			for (uint year = 0; year != nbYears; ++year)
+			{
+				const float v = values[(size_t) year * height + y];
+				if (not Math::NaN(v))
+					sorted.push_back(v);
+			}
+			std::sort(sorted.begin(), sorted.end());
+
+			for (uint q = 0; q != nbQuantiles; ++q)
+			{
+				buffer << '\t';
+				if (sorted.empty())
+					continue;
+				// Linear interpolation between the closest ranks
+				const double rank = quantiles[q] * (double) (sorted.size() - 1);
+				const uint lower = (uint) rank;
+				const uint upper = Math::Min<uint>(lower + 1, (uint) sorted.size() - 1);
+				const double ratio = rank - (double) lower;
+				AppendValueToBuffer(buffer, sorted[lower] + ratio * (sorted[upper] - sorted[lower]));
+			}
+		}
+		buffer << '\n';
+		++Progress::Current;
+
+		if (buffer.size() > 1024 * 1024 * 4)
+		{
+			file << buffer;
+			buffer.clear();
+		}
+	}
+
+	if (not buffer.empty())
+		file << buffer;
+	return true;
+}
+
+
 bool ResultMatrix::saveToCSVFile(const String& filename) const
 {
 	IO::File::Stream file;
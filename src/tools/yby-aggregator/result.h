@@ -30,6 +30,8 @@
 # include <yuni/yuni.h>
 # include <yuni/core/string.h>
 # include <map>
+# include <vector>
+# include <yuni/thread/mutex.h>
 # include <antares/memory/memory.h>
 # include "datafile.h"
 # include "studydata.h"
@@ -72,6 +74,82 @@ public:
 
 
 
+/*!
+** \brief Statistics over all years of a single variable, updated year after year
+**
+** Contrary to ResultMatrix, the values of each year are not kept (unless some
+** quantiles are requested, in which case they are kept as float): the average
+** and the standard deviation are updated incrementally (Welford), like the min
+** and the max, each time a year is merged.
+*/
+class ResultStatistics final
+{
+public:
+	//! \name Constructors & Destructor
+	//@{
+	/*!
+	** \brief Default constructor
+	*/
+	ResultStatistics();
+	//! No copy (the values would be lost silently)
+	ResultStatistics(const ResultStatistics&) = delete;
+	ResultStatistics& operator = (const ResultStatistics&) = delete;
+	//! Destructor
+	~ResultStatistics();
+	//@}
+
+	/*!
+	** \brief Prepare the statistics for a given number of years
+	**
+	** \param keepValues True to keep the values of each year (required for quantiles)
+	*/
+	void resize(uint years, bool keepValues);
+
+	/*!
+	** \brief Merge the values of a single year (thread-safe)
+	**
+	** \return False if the height does not match the one of the previous years
+	*/
+	bool merge(uint year, const double* values, uint height);
+
+	/*!
+	** \brief Export the statistics into a CSV file
+	*/
+	bool saveToCSVFile(const Yuni::String& filename, const std::vector<double>& quantiles) const;
+
+
+public:
+	//! The number of years merged so far
+	uint count;
+	//! The number of rows (0 if no year has been merged)
+	uint height;
+	//! The total number of years
+	uint nbYears;
+	//! Average for each row
+	double* average;
+	//! Sum of the squares of the differences from the average, for each row
+	double* sumOfSquares;
+	//! Min for each row
+	double* minimum;
+	//! Max for each row
+	double* maximum;
+	//! Values of each year (nbYears x height, NaN when missing), or null
+	float* values;
+
+private:
+	void allocate(uint h);
+	void release();
+
+private:
+	//! Flag to know if the values of each year must be kept
+	bool pKeepValues;
+	//! Mutex for merging years from several jobs
+	Yuni::Mutex pMutex;
+
+}; // class ResultStatistics
+
+
+
 class ResultMatrix final
 {
 public:
@@ -104,6 +182,8 @@ public:
 	uint width;
 	//! Valid Height found after aggregation
 	uint heightAfterAggregation;
+	//! Statistics over all years (only when requested, see Output::statistics)
+	ResultStatistics statistics;
 
 }; // class ResultMatrix
 